@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+
+/*
+ * Every algorithm allocates a tensor arena of its own by default, so two
+ * models side by side take the sum of both. After algo_arena_share() the
+ * algorithms registered next keep only their persistent section (tensor and
+ * op data, a fraction of the arena) to themselves and plan their activations
+ * and kernel scratch in one shared region instead. They take turns on it, one
+ * Invoke() at a time, so the activations take the largest model's size, not
+ * the sum. A model may also be invoked from another's postprocess, for a
+ * cascade on the regions the first one found.
+ *
+ * size: bytes of the shared region, enough for the activations and scratch of
+ *       the largest model
+ * returns 0 on success, -1 if out of memory or already shared
+ */
+int algo_arena_share(size_t size);
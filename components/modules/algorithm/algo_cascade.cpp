@@ -0,0 +1,30 @@
+#include <stdlib.h>
+
+#include "algo_cascade.hpp"
+#include "algo_model.hpp"
+
+static const char *TAG = "gauge";
+
+int register_gauge_reader(const QueueHandle_t frame_i,
+                          const QueueHandle_t event,
+                          const QueueHandle_t result,
+                          const QueueHandle_t frame_o,
+                          const bool camera_fb_return,
+                          const uint8_t max_meters)
+{
+    // the meter model runs in the postprocess task of yolo, with its own invoke stack
+    pipeline::Config config = vision_config(TAG, 8 * 1024);
+    VisionModel *yolo = yolo_model(result, config.slots);
+    VisionModel *meter = meter_model(nullptr, 1);
+    if (yolo == nullptr || meter == nullptr)
+    {
+        return -1;
+    }
+    yolo->set_cascade(meter, max_meters);
+
+    static pipeline::QueueSource camera(frame_i, camera_fb_return ? camera_frame_return : nullptr);
+    static pipeline::QueueSink display(frame_o);
+    static pipeline::Pipeline algo(*yolo, camera, frame_o ? &display : nullptr);
+
+    return algo.start(config, event);
+}
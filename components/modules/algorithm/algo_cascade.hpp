@@ -0,0 +1,31 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "algo_arena.hpp"
+#include "algo_control.hpp"
+#include "algo_result.hpp"
+
+/*
+ * Gauge reader: YOLO finds the gauges in the frame and the PFLD meter model
+ * reads the pointer of each one from a crop of it. The result objects are the
+ * gauges, their details the pointer tips, both in frame coordinates.
+ *
+ * max_meters: meter invocations per frame at most, the most confident gauges
+ *             first, the others are counted as skipped
+ * Takes the place of register_algo_yolo() and register_pfld_meter(), the
+ * models are the same ones. Call algo_arena_share() first to have both of
+ * them on one tensor arena.
+ */
+/* event: optional queue of algo_control_t, see algo_control_create() */
+/* result: optional queue of algo_result_t *, every record taken from it goes back with algo_result_release() */
+/* camera_fb_return: frames done with (dropped, or processed without frame_o) go back with esp_camera_fb_return(), false if they stay the caller's */
+int register_gauge_reader(const QueueHandle_t frame_i,
+                          const QueueHandle_t event,
+                          const QueueHandle_t result,
+                          const QueueHandle_t frame_o,
+                          const bool camera_fb_return,
+                          const uint8_t max_meters);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+/*
+ * Commands for the event queue of the register_algo_*() functions. The
+ * algorithm acts on them between frames: paused, every one of its tasks is
+ * blocked and it takes no CPU time, a single shot runs one frame through and
+ * pauses again. A queue of bool still works, false pauses and true runs.
+ */
+typedef uint8_t algo_control_t;
+
+enum
+{
+    ALGO_PAUSE = 0,
+    ALGO_RUN = 1,
+    ALGO_SINGLE_SHOT = 2,
+};
+
+/* a queue to pass as the event of register_algo_*() */
+static inline QueueHandle_t algo_control_create(void)
+{
+    return xQueueCreate(4, sizeof(algo_control_t));
+}
+
+/* false if the queue is full, the command is not waited for */
+static inline bool algo_control(QueueHandle_t event, algo_control_t command)
+{
+    return xQueueSend(event, &command, 0) == pdTRUE;
+}
@@ -1,53 +1,26 @@
 #include <math.h>
 #include <stdint.h>
-#include <forward_list>
+#include <stdlib.h>
 
 #include "algo_fomo.hpp"
+#include "algo_model.hpp"
 #include "fomo_model_data.h"
 
 #include "fb_gfx.h"
-#include "isp.h"
-#include "base64.h"
+#include "app_camera.h"
 
 #include "esp_log.h"
 #include "esp_camera.h"
-#include "esp_heap_caps.h"
-#include "esp_timer.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
-#include "tensorflow/lite/micro/micro_interpreter.h"
-#include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-#include "tensorflow/lite/schema/schema_generated.h"
 
 static const char *TAG = "fomo";
 
-static QueueHandle_t xQueueFrameI = NULL;
-static QueueHandle_t xQueueEvent = NULL;
-static QueueHandle_t xQueueFrameO = NULL;
-static QueueHandle_t xQueueResult = NULL;
-
-static bool gEvent = true;
-static bool gReturnFB = true;
-static bool debug_mode = false;
-
-
-// Globals, used for compatibility with Arduino-style sketches.
 namespace
 {
-    const tflite::Model *model = nullptr;
-    tflite::MicroInterpreter *interpreter = nullptr;
-    TfLiteTensor *input = nullptr;
-
-    // In order to use optimized tensorflow lite kernels, a signed int8_t quantized
-    // model is preferred over the legacy unsigned model format. This means that
-    // throughout this project, input images must be converted from unisgned to
-    // signed format. The easiest and quickest way to convert from unsigned to
-    // signed 8-bit integers is to subtract 128 from the unsigned value to get a
-    // signed value.
-
 #ifdef CONFIG_IDF_TARGET_ESP32S3
     constexpr int scratchBufSize = 1024 * 1024;
 #else
@@ -55,138 +28,82 @@ namespace
 #endif
     // An area of memory to use for input, output, and intermediate arrays.
     constexpr int kTensorArenaSize = 256 * 1024 + scratchBufSize;
-    static uint8_t *tensor_arena; //[kTensorArenaSize]; // Maybe we should move this to external
-} //
-
-static void task_process_handler(void *arg)
-{
-    camera_fb_t *frame = NULL;
+    // Tensor and op data, all the model keeps when the arena is shared (algo_arena_share()).
+    constexpr int kPersistentArenaSize = 64 * 1024;
 
-    uint16_t h = input->dims->data[1];
-    uint16_t w = input->dims->data[2];
-    uint16_t c = input->dims->data[3];
-
-    while (true)
+    class Fomo : public VisionModel
     {
-        if (gEvent)
+    public:
+        explicit Fomo(QueueHandle_t results)
+            : VisionModel("fomo", g_fomo_model_data, kTensorArenaSize, results, kPersistentArenaSize)
         {
-            if (xQueueReceive(xQueueFrameI, &frame, portMAX_DELAY))
-            {
-                int dsp_start_time = esp_timer_get_time() / 1000;
-        
-                if (c == 1)
-                    rgb565_to_gray(input->data.uint8, frame->buf, frame->height, frame->width, h, w, ROTATION_UP);
-                else if (c == 3)
-                    rgb565_to_rgb888(input->data.uint8, frame->buf, frame->height, frame->width, h, w, ROTATION_UP);
-
-                int dsp_end_time = esp_timer_get_time() / 1000;
-
-                if (debug_mode)
-                {
-                    printf("Begin output\n");
-                    printf("Format: {\"height\": %d, \"width\": %d, \"channels\": %d, \"model\": \"fomo\"}\r\n", h, w, c);
-                    printf("Framebuffer: ");
-                    base64_encode(input->data.uint8, input->bytes, putchar);
-                    printf("\r\n");
-                }
-
-                for (int i = 0; i < input->bytes; i++)
-                {
-                    input->data.int8[i] = input->data.uint8[i] - 128;
-                }
-
-                // Run the model on this input and make sure it succeeds.
-                int start_time = esp_timer_get_time() / 1000;
-                printf("Invoke\n");
-                if (kTfLiteOk != interpreter->Invoke())
-                {
-                    MicroPrintf("Invoke failed.");
-                }
-                printf("Invoke done\n");
-                int end_time = esp_timer_get_time() / 1000;
+        }
 
-                vTaskDelay(10 / portTICK_PERIOD_MS);
+    protected:
+        void process_output(camera_fb_t *frame, TfLiteTensor *output, const isp_transform_t *transform,
+                            algo_result_t *result) override
+        {
+            uint16_t h = input->dims->data[1];
+            uint16_t w = input->dims->data[2];
 
-                TfLiteTensor *output = interpreter->output(0);
+            uint16_t n_h = output->dims->data[1]; // result in row
+            uint16_t n_w = output->dims->data[2]; // result in col
+            uint16_t n_t = output->dims->data[3]; // result in target
 
-                uint16_t n_h = output->dims->data[1]; // result in row
-                uint16_t n_w = output->dims->data[2]; // result in col
-                uint16_t n_t = output->dims->data[3]; // result in target
+            bool found = false;
+            for (int i = 0; i < n_h; i++)
+            {
 
-                printf("Predictions (DSP: %d ms., Classification: %d ms., Anomaly: %d ms.): \n", (dsp_end_time - dsp_start_time), (end_time - start_time), 0);
-                bool found = false;
-                for (int i = 0; i < n_h; i++)
+                for (int j = 0; j < n_w; j++)
                 {
-
-                    for (int j = 0; j < n_w; j++)
+                    uint8_t max_conf = 0;
+                    uint8_t max_target = 0;
+                    for (int t = 0; t < n_t; t++)
                     {
-                        uint8_t max_conf = 0;
-                        uint8_t max_target = 0;
-                        for (int t = 0; t < n_t; t++)
-                        {
-                            uint8_t conf = (output->data.int8[i * n_w * n_t + j * n_t + t] - output->params.zero_point) * output->params.scale * 100;
-                            if (conf > max_conf)
-                            {
-                                max_conf = conf;
-                                max_target = t;
-                            }
-                        }
-                        if (max_conf >50 && max_target != 0)
+                        uint8_t conf = (output->data.int8[i * n_w * n_t + j * n_t + t] - output->params.zero_point) * output->params.scale * 100;
+                        if (conf > max_conf)
                         {
-                            found = true;
-                            fomo_t obj;
-                            obj.x = j * w / n_w + (w / n_w) / 2;
-                            obj.y = i * h / n_h + (h / n_h) / 2;
-                            obj.confidence = max_conf;
-                            obj.target = max_target;
-
-                            fb_gfx_drawCicle(frame, obj.x * (frame->width / w), obj.y * (frame->height / h), frame->width / n_w, 0xF800);
-                            fb_gfx_printf(frame, obj.x, obj.y, 0x000F, "%s:%d", g_fomo_model_classes[obj.target - 1], obj.confidence);
-
-                            printf("    %s (", g_fomo_model_classes[obj.target - 1]);
-                            printf("%f", obj.confidence / 100.0f);
-                            printf(") [ x: %u, y: %u, width: %u, height: %u ]\n", obj.x, obj.y, w / n_w, h / n_h);
+                            max_conf = conf;
+                            max_target = t;
                         }
                     }
+                    if (max_conf > 50 && max_target != 0)
+                    {
+                        found = true;
+                        fomo_t obj;
+                        obj.x = j * w / n_w + (w / n_w) / 2;
+                        obj.y = i * h / n_h + (h / n_h) / 2;
+                        obj.confidence = max_conf;
+                        obj.target = max_target;
+
+                        EVLOG(&log, "    %s (%f) [ x: %u, y: %u, width: %u, height: %u ]\n",
+                              EVLOG_S(g_fomo_model_classes[obj.target - 1]), EVLOG_F(obj.confidence / 100.0f),
+                              EVLOG_I(obj.x), EVLOG_I(obj.y), EVLOG_I(w / n_w), EVLOG_I(h / n_h));
+
+                        // the cell, back in frame coordinates
+                        algo_result_add(result, isp_source_x(transform, obj.x), isp_source_y(transform, obj.y),
+                                        isp_source_w(transform, w / n_w), isp_source_h(transform, h / n_h),
+                                        obj.confidence, obj.target);
+                    }
                 }
-                if (!found)
-                {
-                    printf("    No objects found\n");
-                }
-                if (debug_mode)
-                {
-                    printf("End output\n");
-                }
-            }
-
-            if (xQueueFrameO)
-            {
-                xQueueSend(xQueueFrameO, &frame, portMAX_DELAY);
-            }
-            else if (gReturnFB)
-            {
-                esp_camera_fb_return(frame);
             }
-            else
+            if (!found)
             {
-                free(frame);
+                EVLOG(&log, "    No objects found\n");
             }
+        }
 
-            if (xQueueResult)
+        void draw_result(camera_fb_t *frame, const algo_result_t *result) override
+        {
+            for (uint16_t i = 0; i < result->count; i++)
             {
-                xQueueSend(xQueueResult, NULL, portMAX_DELAY);
+                const algo_object_t &obj = result->objects[i];
+                fb_gfx_drawCicle(frame, obj.x, obj.y, obj.w, 0xF800);
+                fb_gfx_printf(frame, obj.x, obj.y, 0x000F, "%s:%d", g_fomo_model_classes[obj.target - 1], obj.confidence);
             }
         }
-    }
-}
-
-static void task_event_handler(void *arg)
-{
-    while (true)
-    {
-        xQueueReceive(xQueueEvent, &(gEvent), portMAX_DELAY);
-    }
-}
+    };
+} //
 
 int register_algo_fomo(const QueueHandle_t frame_i,
                        const QueueHandle_t event,
@@ -194,31 +111,7 @@ int register_algo_fomo(const QueueHandle_t frame_i,
                        const QueueHandle_t frame_o,
                        const bool camera_fb_return)
 {
-    xQueueFrameI = frame_i;
-    xQueueFrameO = frame_o;
-    xQueueEvent = event;
-    xQueueResult = result;
-    gReturnFB = camera_fb_return;
-
-    // get model (.tflite) from flash
-    model = tflite::GetModel(g_fomo_model_data);
-    if (model->version() != TFLITE_SCHEMA_VERSION)
-    {
-        MicroPrintf("Model provided is schema version %d not equal to supported "
-                    "version %d.",
-                    model->version(), TFLITE_SCHEMA_VERSION);
-        return -1;
-    }
-
-    if (tensor_arena == NULL)
-    {
-        tensor_arena = (uint8_t *)heap_caps_malloc(kTensorArenaSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    }
-    if (tensor_arena == NULL)
-    {
-        printf("Couldn't allocate memory of %d bytes\n", kTensorArenaSize);
-        return -1;
-    }
+    static Fomo fomo(result);
 
     static tflite::MicroMutableOpResolver<6> micro_op_resolver;
     micro_op_resolver.AddPad();
@@ -227,26 +120,16 @@ int register_algo_fomo(const QueueHandle_t frame_i,
     micro_op_resolver.AddConv2D();
     micro_op_resolver.AddSoftmax();
     micro_op_resolver.AddDepthwiseConv2D();
-    // Build an interpreter to run the model with.
-    // NOLINTNEXTLINE(runtime-global-variables)
-    static tflite::MicroInterpreter static_interpreter(
-        model, micro_op_resolver, tensor_arena, kTensorArenaSize);
-    interpreter = &static_interpreter;
-
-    // Allocate memory from the tensor_arena for the model's tensors.
-    TfLiteStatus allocate_status = interpreter->AllocateTensors();
-    if (allocate_status != kTfLiteOk)
+
+    pipeline::Config config = vision_config(TAG, 8 * 1024);
+    if (fomo.init(micro_op_resolver, config.slots) != 0)
     {
-        MicroPrintf("AllocateTensors() failed");
         return -1;
     }
 
-    // Get information about the memory area to use for the model's input.
-    input = interpreter->input(0);
-
-    xTaskCreatePinnedToCore(task_process_handler, TAG, 8 * 1024, NULL, 5, NULL, 0);
-    if (xQueueEvent)
-        xTaskCreatePinnedToCore(task_event_handler, TAG, 8 * 1024, NULL, 5, NULL, 1);
+    static pipeline::QueueSource camera(frame_i, camera_fb_return ? camera_frame_return : nullptr);
+    static pipeline::QueueSink display(frame_o);
+    static pipeline::Pipeline algo(fomo, camera, frame_o ? &display : nullptr);
 
-    return 0;
+    return algo.start(config, event);
 }
@@ -5,6 +5,10 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 
+#include "algo_arena.hpp"
+#include "algo_control.hpp"
+#include "algo_result.hpp"
+
 typedef struct
 {
     uint8_t x;
@@ -13,6 +17,9 @@ typedef struct
     uint8_t target;
 } fomo_t;
 
+/* event: optional queue of algo_control_t, see algo_control_create() */
+/* result: optional queue of algo_result_t *, every record taken from it goes back with algo_result_release() */
+/* camera_fb_return: frames done with (dropped, or processed without frame_o) go back with esp_camera_fb_return(), false if they stay the caller's */
 int register_algo_fomo(const QueueHandle_t frame_i,
                        const QueueHandle_t event,
                        const QueueHandle_t result,
@@ -5,14 +5,23 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 
+#include "algo_arena.hpp"
+#include "algo_control.hpp"
+#include "algo_result.hpp"
+#include "isp.h"
+
 typedef struct
 {
     uint16_t x;
     uint16_t y;
 } meter_t;
 
+/* event: optional queue of algo_control_t, see algo_control_create() */
+/* result: optional queue of algo_result_t *, every record taken from it goes back with algo_result_release() */
+/* camera_fb_return: frames done with (dropped, or processed without frame_o) go back with esp_camera_fb_return(), false if they stay the caller's */
 int register_pfld_meter(const QueueHandle_t frame_i,
                         const QueueHandle_t event,
                         const QueueHandle_t result,
                         const QueueHandle_t frame_o,
-                        const bool camera_fb_return);
+                        const bool camera_fb_return,
+                        const isp_rect_t *roi = nullptr); // part of the frame holding the gauge, nullptr for all of it
@@ -0,0 +1,522 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "algo_model.hpp"
+#include "algo_arena.hpp"
+#include "algo_control.hpp"
+#include "base64.h"
+#include "fb_gfx.h"
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+void StagedInterpreter::set_input_data(size_t index, void *data)
+{
+    // kernels read the eval tensor, input() is kept in step for the callers
+    TfLiteEvalTensor *tensor = context().GetEvalTensor(&context(), inputs().Get(index));
+    tensor->data.data = data;
+    input(index)->data.data = data;
+}
+
+static SharedArena *g_shared_arena = nullptr;
+
+SharedArena::SharedArena(uint8_t *data, size_t size)
+    : buffer(data), length(size), lock(xSemaphoreCreateMutex())
+{
+}
+
+SharedArena *shared_arena()
+{
+    return g_shared_arena;
+}
+
+int algo_arena_share(size_t size)
+{
+    if (g_shared_arena)
+    {
+        return -1;
+    }
+    uint8_t *data = (uint8_t *)heap_caps_aligned_alloc(16, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (data == nullptr)
+    {
+        printf("Couldn't allocate memory of %d bytes\n", (int)size);
+        return -1;
+    }
+    g_shared_arena = new SharedArena(data, size);
+    return 0;
+}
+
+TfliteModel::TfliteModel(const char *name, const unsigned char *model_data, size_t arena_size,
+                         QueueHandle_t results, size_t persistent_size)
+    : name(name), model_data(model_data), arena_size(arena_size), persistent_size(persistent_size),
+      model(nullptr), shared(nullptr), interpreter(nullptr), input(nullptr), tensor_arena(nullptr), debug_mode(false), nslots(1), inputs{}, outputs{},
+      results(results), pool(nullptr), scratch(), results_dropped(0), log()
+{
+}
+
+TfliteModel::~TfliteModel()
+{
+    for (uint8_t i = 0; i < kMaxSlots; i++)
+    {
+        heap_caps_free(inputs[i]);
+    }
+    delete interpreter;
+    heap_caps_free(tensor_arena);
+}
+
+int TfliteModel::init(const tflite::MicroOpResolver &resolver, uint8_t slots)
+{
+    if (results && pool == nullptr)
+    {
+        // as many as a consumer may sit on, plus the one being filled
+        pool = algo_result_pool_create(kResultRecords);
+        if (pool == nullptr)
+        {
+            return -1;
+        }
+    }
+
+    if (log.records == nullptr)
+    {
+        // printf to the console takes milliseconds a line, so postprocess only queues the
+        // lines and a task below every pipeline stage prints them in the idle time
+        if (evlog_init(&log, kLogRecords) != 0 || evlog_start(&log, 1, -1, nullptr, nullptr) != 0)
+        {
+            return -1;
+        }
+    }
+
+    // get model (.tflite) from flash
+    model = tflite::GetModel(model_data);
+    if (model->version() != TFLITE_SCHEMA_VERSION)
+    {
+        MicroPrintf("Model provided is schema version %d not equal to supported "
+                    "version %d.",
+                    model->version(), TFLITE_SCHEMA_VERSION);
+        return -1;
+    }
+
+    // on the shared arena only the persistent section is the model's own
+    if (interpreter == nullptr)
+    {
+        shared = persistent_size ? shared_arena() : nullptr;
+    }
+    size_t own_size = shared ? persistent_size : arena_size;
+    if (tensor_arena == NULL)
+    {
+        tensor_arena = (uint8_t *)heap_caps_aligned_alloc(16, own_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (tensor_arena == NULL)
+    {
+        printf("Couldn't allocate memory of %d bytes\n", (int)own_size);
+        return -1;
+    }
+
+    // Build an interpreter to run the model with.
+    if (interpreter == nullptr && shared)
+    {
+        // the allocator lives in the persistent section it manages
+        tflite::MicroAllocator *allocator = tflite::MicroAllocator::Create(tensor_arena, persistent_size,
+                                                                           shared->data(), shared->size());
+        interpreter = new StagedInterpreter(model, resolver, allocator);
+    }
+    else if (interpreter == nullptr)
+    {
+        interpreter = new StagedInterpreter(model, resolver, tensor_arena, arena_size);
+    }
+
+    // Allocate memory from the tensor_arena for the model's tensors, planning
+    // uses the shared region as scratch
+    if (shared)
+    {
+        shared->take();
+    }
+    TfLiteStatus allocate_status = interpreter->AllocateTensors();
+    if (shared)
+    {
+        shared->give();
+    }
+    if (allocate_status != kTfLiteOk)
+    {
+        MicroPrintf("AllocateTensors() failed");
+        return -1;
+    }
+
+    // Get information about the memory area to use for the model's input.
+    input = interpreter->input(0);
+
+    if (shared)
+    {
+        // what the persistent sections of the models can be trimmed (or have to grow) to
+        printf("%s: %d bytes of tensor arena used, persistent section %d, shared region %d\n", name,
+               (int)interpreter->arena_used_bytes(), (int)persistent_size, (int)shared->size());
+    }
+
+    // the debug dump of a frame and its results must not interleave with the next frame's
+    nslots = debug_mode || slots < 1 ? 1 : slots > kMaxSlots ? kMaxSlots : slots;
+    if (nslots > 1 || shared)
+    {
+        // the arena reuses the input for intermediate tensors during Invoke(), and the other
+        // models on a shared arena reuse all of it, so every slot stages its input (and keeps
+        // its output) in a buffer of its own
+        TfLiteTensor *out = interpreter->output(0);
+        size_t input_bytes = (input->bytes + 15) & ~15;
+        for (uint8_t i = 0; i < nslots; i++)
+        {
+            if (inputs[i] == nullptr)
+            {
+                inputs[i] = (int8_t *)heap_caps_aligned_alloc(16, input_bytes + out->bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            }
+            if (inputs[i] == nullptr)
+            {
+                printf("Couldn't allocate memory of %d bytes\n", (int)(input_bytes + out->bytes));
+                return -1;
+            }
+            outputs[i] = *out;
+            outputs[i].data.int8 = inputs[i] + input_bytes;
+        }
+    }
+    return 0;
+}
+
+bool TfliteModel::invoke(pipeline::Job &job)
+{
+    if (shared)
+    {
+        shared->take();
+    }
+    if (staged())
+    {
+        interpreter->set_input_data(0, inputs[job.slot]);
+    }
+
+    // Run the model on this input and make sure it succeeds.
+    bool ok = interpreter->Invoke() == kTfLiteOk;
+    if (!ok)
+    {
+        MicroPrintf("Invoke failed.");
+    }
+    else if (staged())
+    {
+        // the next Invoke() overwrites the arena while this slot is still in postprocess
+        memcpy(outputs[job.slot].data.int8, interpreter->output(0)->data.int8, outputs[job.slot].bytes);
+    }
+
+    if (shared)
+    {
+        shared->give();
+    }
+    return ok;
+}
+
+algo_result_t *TfliteModel::begin_result(const pipeline::Job &job)
+{
+    algo_result_t *result = results ? algo_result_take(pool) : nullptr;
+    if (result == nullptr)
+    {
+        result = &scratch;
+        result->count = 0;
+        result->lost = 0;
+        result->crops = 0;
+        result->skipped = 0;
+    }
+    result->model = name;
+    result->frame = job.seq;
+    result->preprocess_us = uint32_t(job.elapsed(pipeline::STAGE_PREPROCESS));
+    result->invoke_us = uint32_t(job.elapsed(pipeline::STAGE_INVOKE));
+    return result;
+}
+
+void TfliteModel::publish_result(const pipeline::Job &job, algo_result_t *result)
+{
+    if (result == &scratch)
+    {
+        return;
+    }
+    result->postprocess_us = uint32_t(pipeline::now() - job.start[pipeline::STAGE_POSTPROCESS]);
+    if (xQueueSend(results, &result, 0) != pdTRUE)
+    {
+        algo_result_release(result);
+        results_dropped++;
+    }
+}
+
+// the event queue of register_algo_*() goes straight to the pipeline
+static_assert(int(ALGO_PAUSE) == pipeline::CONTROL_PAUSE && int(ALGO_RUN) == pipeline::CONTROL_RUN &&
+                  int(ALGO_SINGLE_SHOT) == pipeline::CONTROL_SINGLE_SHOT,
+              "algo_control_t and pipeline::Control differ");
+
+pipeline::Config vision_config(const char *name, uint32_t stack)
+{
+#if CONFIG_ALGO_DOUBLE_BUFFER
+    pipeline::Config config = pipeline::pipelined_config(name, stack);
+#else
+    pipeline::Config config = pipeline::default_config(name, stack);
+#endif
+#if CONFIG_ALGO_LATEST_FRAME
+    config.policy = pipeline::POLICY_LATEST_FRAME;
+#endif
+#ifdef CONFIG_ALGO_STATS_INTERVAL
+    config.stats_interval = CONFIG_ALGO_STATS_INTERVAL;
+#endif
+    return config;
+}
+
+VisionModel::VisionModel(const char *name, const unsigned char *model_data, size_t arena_size,
+                         QueueHandle_t results, size_t persistent_size)
+    : TfliteModel(name, model_data, arena_size, results, persistent_size), isp_config(), transforms(), jpeg(),
+      cascade(nullptr), max_crops(0), gate(), gate_isp(), last()
+{
+}
+
+VisionModel::~VisionModel()
+{
+    isp_release(&isp_config);
+    isp_release(&gate_isp);
+    jpeg_release(&jpeg);
+    frame_gate_release(&gate);
+}
+
+int VisionModel::init(const tflite::MicroOpResolver &resolver, uint8_t slots)
+{
+    if (TfliteModel::init(resolver, slots) != 0)
+    {
+        return -1;
+    }
+
+    isp_quant_table(qtable, input->params.scale, input->params.zero_point);
+
+    isp_config.format = ISP_FORMAT_RGB565;
+    isp_config.channels = input->dims->data[3];
+    isp_config.rotation = ROTATION_UP;
+    isp_config.filter = ISP_FILTER_DEFAULT;
+    // with two slots the other core is busy running the model
+    isp_config.parallel = nslots == 1 && isp_worker_init() == 0;
+    isp_config.th = input->dims->data[1];
+    isp_config.tw = input->dims->data[2];
+    isp_config.qtable = qtable;
+
+#if CONFIG_ALGO_MOTION_GATE
+    if (init_gate(CONFIG_ALGO_GATE_THRESHOLD, CONFIG_ALGO_GATE_AREA, CONFIG_ALGO_GATE_MAX_SKIP) != 0)
+    {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+int VisionModel::init_gate(uint8_t threshold, uint8_t area, uint16_t max_skip)
+{
+    frame_gate_release(&gate);
+    if (max_skip == 0)
+    {
+        return 0;
+    }
+
+    // a thumbnail coarse enough to average out the sensor noise, the gray of the model's own filter
+    isp_release(&gate_isp);
+    gate_isp = isp_config_t();
+    gate_isp.channels = 1;
+    gate_isp.rotation = ROTATION_UP;
+    gate_isp.filter = ISP_FILTER_AREA;
+    gate_isp.th = 24;
+    gate_isp.tw = 32;
+    return frame_gate_init(&gate, gate_isp.tw, gate_isp.th, threshold, area, max_skip);
+}
+
+bool VisionModel::preprocess(pipeline::Job &job)
+{
+    camera_fb_t *frame = (camera_fb_t *)job.frame;
+    int8_t *data = input_data(job.slot);
+
+    // the debug dump wants fresh results on every frame
+    if (!debug_mode && predict_frame())
+    {
+        job.skip = true;
+        return true;
+    }
+    if (gate.thumbnail && !debug_mode)
+    {
+        if (camera_convert(frame_gate_thumbnail(&gate), frame, &gate_isp, &jpeg) == 0 && !frame_gate_check(&gate))
+        {
+            job.skip = true;
+            return true;
+        }
+    }
+
+    if (debug_mode)
+    {
+        // the dump wants the plain image, so convert it once more in uint8 first
+        isp_config.qtable = NULL;
+        camera_convert(data, frame, &isp_config, &jpeg);
+        isp_config.qtable = qtable;
+
+        // the results of the previous frame go out before this frame's dump
+        evlog_flush(&log, 1000);
+        printf("Begin output\n");
+        printf("Format: {\"height\": %d, \"width\": %d, \"channels\": %d, \"model\": \"%s\"}\r\n",
+               input->dims->data[1], input->dims->data[2], input->dims->data[3], name);
+        printf("Framebuffer: ");
+        base64_encode((uint8_t *)data, input->bytes, putchar);
+        printf("\r\n");
+    }
+
+    if (camera_convert(data, frame, &isp_config, &jpeg) != 0)
+    {
+        return false;
+    }
+    transforms[job.slot] = isp_config.transform;
+    return true;
+}
+
+static void copy_objects(algo_result_t *to, const algo_result_t *from)
+{
+    to->count = from->count;
+    to->lost = from->lost;
+    to->crops = from->crops;
+    to->skipped = from->skipped;
+    memcpy(to->objects, from->objects, from->count * sizeof(algo_object_t));
+    memcpy(to->details, from->details, (from->crops ? from->count : 0) * sizeof(algo_object_t));
+}
+
+void VisionModel::postprocess(pipeline::Job &job)
+{
+    camera_fb_t *frame = (camera_fb_t *)job.frame;
+    algo_result_t *result = begin_result(job);
+    result->width = frame->width;
+    result->height = frame->height;
+
+    if (job.skip && predict_output(frame, result))
+    {
+        EVLOG(&log, "Predictions (DSP: %d ms., tracked, %d objects predicted): \n",
+              EVLOG_I(job.elapsed(pipeline::STAGE_PREPROCESS) / 1000), EVLOG_I(result->count));
+        if (gate.thumbnail)
+        {
+            copy_objects(&last, result);
+        }
+    }
+    else if (job.skip)
+    {
+        // nothing moved, the objects are where they were
+        EVLOG(&log, "Predictions (DSP: %d ms., unchanged, %d objects as before): \n",
+              EVLOG_I(job.elapsed(pipeline::STAGE_PREPROCESS) / 1000), EVLOG_I(last.count));
+        copy_objects(result, &last);
+    }
+    else
+    {
+        EVLOG(&log, "Predictions (DSP: %d ms., Classification: %d ms., Anomaly: %d ms.): \n",
+              EVLOG_I(job.elapsed(pipeline::STAGE_PREPROCESS) / 1000), EVLOG_I(job.elapsed(pipeline::STAGE_INVOKE) / 1000), EVLOG_I(0));
+
+        process_output(frame, output(job.slot), &transforms[job.slot], result);
+        if (cascade)
+        {
+            int64_t start = pipeline::now();
+            cascade->run_crops(frame, result, max_crops);
+            for (uint16_t i = 0; i < result->count && result->crops; i++)
+            {
+                const algo_object_t &detail = result->details[i];
+                if (detail.confidence == 0)
+                {
+                    continue;
+                }
+                EVLOG(&log, "    %s (%f) [ x: %u, y: %u, object: %u ]\n", EVLOG_S(cascade->name),
+                      EVLOG_F(detail.confidence / 100.0f), EVLOG_I(detail.x), EVLOG_I(detail.y), EVLOG_I(i));
+            }
+            EVLOG(&log, "    %s: %d crops in %d ms, %d skipped\n", EVLOG_S(cascade->name), EVLOG_I(result->crops),
+                  EVLOG_I((pipeline::now() - start) / 1000), EVLOG_I(result->skipped));
+        }
+        if (gate.thumbnail)
+        {
+            copy_objects(&last, result);
+        }
+    }
+
+    draw_result(frame, result);
+    for (uint16_t i = 0; i < result->count && result->crops; i++)
+    {
+        const algo_object_t &detail = result->details[i];
+        if (detail.confidence == 0)
+        {
+            continue;
+        }
+        fb_gfx_fillRect(frame, detail.x - 2, detail.y - 2, 4, 4, 0x07E0);
+    }
+    publish_result(job, result);
+
+    if (debug_mode)
+    {
+        EVLOG(&log, "End output\n");
+    }
+}
+
+void VisionModel::set_cascade(VisionModel *next, uint8_t max_crops)
+{
+    cascade = next;
+    this->max_crops = max_crops;
+    if (next)
+    {
+        // the crops are converted in postprocess, which has the other core to itself only without overlap
+        next->isp_config.parallel = nslots == 1;
+    }
+}
+
+void VisionModel::run_crops(camera_fb_t *frame, algo_result_t *result, uint16_t max)
+{
+    int batch = input->dims->data[0];
+    batch = batch < 1 ? 1 : batch > kMaxBatch ? kMaxBatch : batch;
+    size_t crop_bytes = input->bytes / batch;
+    isp_transform_t crops[kMaxBatch];
+    isp_rect_t roi = isp_config.roi;
+
+    // the most confident boxes first, so the cap leaves out the least likely ones; the objects keep their order
+    uint8_t order[ALGO_RESULT_MAX_OBJECTS];
+    uint16_t boxes = 0;
+    for (uint16_t i = 0; i < result->count; i++)
+    {
+        const algo_object_t &object = result->objects[i];
+        result->details[i] = {};
+        // an empty box would be a zero-size roi, which isp takes for the whole frame
+        if (object.w == 0 || object.h == 0)
+        {
+            continue;
+        }
+        uint16_t j = boxes++;
+        for (; j > 0 && result->objects[order[j - 1]].confidence < object.confidence; j--)
+        {
+            order[j] = order[j - 1];
+        }
+        order[j] = uint8_t(i);
+    }
+
+    uint16_t n = boxes < max ? boxes : max;
+    result->crops = 0;
+    result->skipped = boxes - n;
+
+    // the second stage has no pipeline of its own, slot 0 is free
+    pipeline::Job job = {};
+    for (uint16_t first = 0; first < n; first += batch)
+    {
+        int count = n - first < batch ? n - first : batch;
+        bool ok = true;
+        for (int b = 0; b < count && ok; b++)
+        {
+            const algo_object_t &box = result->objects[order[first + b]];
+            isp_config.roi = {box.x - box.w / 2, box.y - box.h / 2, box.w, box.h};
+            ok = camera_convert(input_data(0) + b * crop_bytes, frame, &isp_config, &jpeg) == 0;
+            crops[b] = isp_config.transform;
+        }
+        if (!ok || !invoke(job))
+        {
+            break;
+        }
+        for (int b = 0; b < count; b++)
+        {
+            process_crop(output(0), b, &crops[b], &result->details[order[first + b]]);
+        }
+        result->crops = first + count;
+    }
+    isp_config.roi = roi;
+}
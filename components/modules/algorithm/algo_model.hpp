@@ -0,0 +1,241 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pipeline.hpp"
+#include "algo_result.hpp"
+#include "app_camera.h"
+#include "evlog.h"
+#include "gate.h"
+#include "isp.h"
+#include "jpeg.h"
+
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+
+/* an interpreter whose input tensors can be pointed at buffers outside the arena */
+class StagedInterpreter : public tflite::MicroInterpreter
+{
+public:
+    using tflite::MicroInterpreter::MicroInterpreter;
+
+    /* the next Invoke() reads input index from data, input(index)->bytes long */
+    void set_input_data(size_t index, void *data);
+};
+
+/* the non-persistent region of algo_arena_share(), one model on it at a time */
+class SharedArena
+{
+public:
+    SharedArena(uint8_t *data, size_t size);
+
+    uint8_t *data() const { return buffer; }
+    size_t size() const { return length; }
+
+    /* hold the region for an Invoke() or AllocateTensors(), waiters queue by priority */
+    void take() { xSemaphoreTake(lock, portMAX_DELAY); }
+    void give() { xSemaphoreGive(lock); }
+
+private:
+    uint8_t *buffer;
+    size_t length;
+    SemaphoreHandle_t lock;
+};
+
+/* the region of algo_arena_share(), nullptr if the models have arenas of their own */
+SharedArena *shared_arena();
+
+/*
+ * A TFLite Micro model as the invoke stage of a pipeline.
+ *
+ * With more than one slot every slot has its own input and output buffer
+ * outside the arena: preprocess fills the input of its slot while the model
+ * runs on another one, invoke points the interpreter at the slot's input and
+ * copies the output out of the arena before the next invoke reuses it.
+ * A model on the shared arena stages its input and output the same way even
+ * with one slot, the other models overwrite everything but its persistent
+ * section between two invokes.
+ */
+class TfliteModel : public pipeline::Model
+{
+public:
+    static constexpr uint8_t kMaxSlots = 2;
+    static constexpr uint8_t kResultRecords = 4;
+    static constexpr size_t kLogRecords = 64;
+
+    /**
+     * @param name        model name, for logs and the debug dump
+     * @param model_data  .tflite flatbuffer
+     * @param arena_size  bytes of tensor arena, taken from PSRAM by init()
+     * @param results     queue of algo_result_t * for the results of each frame, nullptr for none
+     * @param persistent_size  bytes of the persistent section when on the shared arena,
+     *                         0 to keep an arena of its own anyway
+     */
+    TfliteModel(const char *name, const unsigned char *model_data, size_t arena_size,
+                QueueHandle_t results = nullptr, size_t persistent_size = 0);
+    ~TfliteModel() override;
+
+    /**
+     * @brief Load the model and allocate its tensors
+     *
+     * @param resolver  ops of the model, must outlive the model
+     * @param slots     jobs in flight at once, up to kMaxSlots
+     * @return 0 on success, -1 on a schema mismatch or out of memory
+     */
+    virtual int init(const tflite::MicroOpResolver &resolver, uint8_t slots = 1);
+
+    uint8_t slots() const override { return nslots; }
+
+    bool invoke(pipeline::Job &job) override;
+
+protected:
+    /* inputs and outputs live outside the arena */
+    bool staged() const { return inputs[0] != nullptr; }
+
+    /* model input of a slot */
+    int8_t *input_data(uint8_t slot) { return staged() ? inputs[slot] : input->data.int8; }
+
+    /* model output of a slot, valid from invoke until the slot's next preprocess */
+    TfLiteTensor *output(uint8_t slot) { return staged() ? &outputs[slot] : interpreter->output(0); }
+
+    /*
+     * The record for the results of a job, stamped with the frame and stage
+     * timings. Without a result queue, or with every record still held by the
+     * consumer, it is a scratch record that is never published.
+     */
+    algo_result_t *begin_result(const pipeline::Job &job);
+
+    /* queue the record without waiting, a full queue drops it */
+    void publish_result(const pipeline::Job &job, algo_result_t *result);
+
+    const char *name;
+    const unsigned char *model_data;
+    size_t arena_size;
+    size_t persistent_size;
+
+    const tflite::Model *model;
+    SharedArena *shared;
+    StagedInterpreter *interpreter;
+    TfLiteTensor *input;
+    uint8_t *tensor_arena;
+    bool debug_mode;
+
+    uint8_t nslots;
+    int8_t *inputs[kMaxSlots];
+    TfLiteTensor outputs[kMaxSlots]; /* the output tensor, pointing at a copy of its data */
+
+    QueueHandle_t results;
+    algo_result_pool_t *pool;
+    algo_result_t scratch;
+    uint32_t results_dropped; /* records the queue had no room for */
+
+    evlog_t log; /* per-frame output of postprocess, printed by a low-priority task */
+};
+
+/* stages and frame policy of a vision model, from the Algorithm Configuration menu */
+pipeline::Config vision_config(const char *name, uint32_t stack);
+
+/*
+ * A model fed from camera frames: preprocess converts the frame into the
+ * int8 input tensor through isp (or the JPEG decoder), postprocess logs
+ * the timings and hands the output to process_output(). A new vision model
+ * only supplies its ops and process_output().
+ *
+ * A detector can be followed by a second model in a cascade: the second one
+ * runs on a crop of the frame around each box found, as many crops per
+ * invoke as its input has batches, and its output goes with each box as the
+ * object's detail. A model that can be the second stage supplies
+ * process_crop().
+ *
+ * With a gate (CONFIG_ALGO_MOTION_GATE), preprocess first compares a small luminance thumbnail of the
+ * frame with the last frame the model ran on. On a frame that hasn't changed
+ * the conversion and invoke are skipped and postprocess hands on the previous
+ * result again.
+ *
+ * A model that tracks its objects can skip frames of its own: when
+ * predict_frame() says so preprocess skips the frame, and postprocess asks
+ * predict_output() for the objects moved on by the tracker instead.
+ */
+class VisionModel : public TfliteModel
+{
+public:
+    VisionModel(const char *name, const unsigned char *model_data, size_t arena_size,
+                QueueHandle_t results = nullptr, size_t persistent_size = 0);
+    ~VisionModel() override;
+
+    /* also sets up the frame -> input tensor conversion for the model's input */
+    int init(const tflite::MicroOpResolver &resolver, uint8_t slots = 1) override;
+
+    bool preprocess(pipeline::Job &job) override;
+    void postprocess(pipeline::Job &job) override;
+
+    /**
+     * @brief Run a second model on the boxes of every frame
+     *
+     * @param next       second stage, a model that runs no pipeline of its own
+     * @param max_crops  crops per frame at most, the most confident boxes first, to bound the latency
+     */
+    void set_cascade(VisionModel *next, uint8_t max_crops);
+
+    /* frames checked by the gate and frames it skipped */
+    uint32_t gated() const { return gate.frames; }
+    uint32_t skipped() const { return gate.skipped; }
+
+protected:
+    static constexpr int kMaxBatch = 8;
+
+    /* decode the output of this frame into result (in frame coordinates, through the frame's transform) and log it */
+    virtual void process_output(camera_fb_t *frame, TfLiteTensor *output, const isp_transform_t *transform,
+                                algo_result_t *result) = 0;
+
+    /* draw the result on the frame, after the cascade (which must see the frame as it came) and on skipped frames */
+    virtual void draw_result(camera_fb_t *frame, const algo_result_t *result) {}
+
+    /*
+     * The output for one crop, batch index of the output, as a point or box
+     * in frame coordinates through the crop's transform. False if the model
+     * can't be a second stage.
+     */
+    virtual bool process_crop(const TfLiteTensor *output, int index, const isp_transform_t *transform,
+                              algo_object_t *detail) { return false; }
+
+    /* skip the model on this frame, called by preprocess before the gate */
+    virtual bool predict_frame() { return false; }
+
+    /* the result of a skipped frame without running the model, false to hand on the last result */
+    virtual bool predict_output(camera_fb_t *frame, algo_result_t *result) { return false; }
+
+    /* run on the boxes of result, as the second stage, and fill result->details */
+    void run_crops(camera_fb_t *frame, algo_result_t *result, uint16_t max);
+
+    /**
+     * @brief Skip the model on frames that look like the last one it ran on
+     *
+     * Only from init(): preprocess reads the gate without a lock, so it can't
+     * change while the pipeline runs.
+     *
+     * @param threshold  luminance step of a thumbnail pixel that counts as a change
+     * @param area       % of the thumbnail that has to change
+     * @param max_skip   frames skipped in a row at most, 0 to run on every frame
+     * @return 0 on success, -1 if out of memory
+     */
+    int init_gate(uint8_t threshold, uint8_t area, uint16_t max_skip);
+
+    int8_t qtable[256];     // pixel -> quantized input lookup
+    isp_config_t isp_config; // frame -> input tensor conversion
+    isp_transform_t transforms[kMaxSlots]; // of each slot's frame, the next preprocess rewrites isp_config.transform
+    jpeg_decoder_t jpeg;     // scratch for JPEG frames
+
+    VisionModel *cascade; // second stage, nullptr for none
+    uint8_t max_crops;
+
+    frame_gate_t gate;     // scene change gate, no thumbnail without one
+    isp_config_t gate_isp; // frame -> thumbnail conversion
+    algo_result_t last;    // result of the last frame the model ran on, for the skipped ones
+};
+
+/* the models, loaded on the first call with their ops (later calls return the same one), nullptr on error */
+VisionModel *yolo_model(QueueHandle_t results, uint8_t slots);
+VisionModel *meter_model(QueueHandle_t results, uint8_t slots);
@@ -5,6 +5,12 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 
+#include "algo_arena.hpp"
+#include "algo_control.hpp"
+#include "algo_result.hpp"
+
+/* event: optional queue of algo_control_t, see algo_control_create() */
+/* result: optional queue of algo_result_t *, every record taken from it goes back with algo_result_release() */
 int register_algo_motion(const QueueHandle_t data_i,
                        const QueueHandle_t event,
                        const QueueHandle_t result);
@@ -0,0 +1,96 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algo_result.hpp"
+
+struct algo_result_pool
+{
+    QueueHandle_t free; /* algo_result_t * not taken */
+    uint8_t count;
+    volatile uint32_t misses;
+    algo_result_t *records;
+};
+
+algo_result_pool_t *algo_result_pool_create(uint8_t count)
+{
+    algo_result_pool_t *pool = (algo_result_pool_t *)calloc(1, sizeof(algo_result_pool_t));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+    pool->records = (algo_result_t *)calloc(count ? count : 1, sizeof(algo_result_t));
+    pool->free = xQueueCreate(count ? count : 1, sizeof(algo_result_t *));
+    if (pool->records == NULL || pool->free == NULL)
+    {
+        if (pool->free)
+        {
+            vQueueDelete(pool->free);
+        }
+        free(pool->records);
+        free(pool);
+        return NULL;
+    }
+    pool->count = count;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        algo_result_t *result = &pool->records[i];
+        result->pool = pool;
+        xQueueSend(pool->free, &result, 0);
+    }
+    return pool;
+}
+
+algo_result_t *algo_result_take(algo_result_pool_t *pool)
+{
+    algo_result_t *result = NULL;
+    if (pool == NULL || xQueueReceive(pool->free, &result, 0) != pdTRUE)
+    {
+        if (pool)
+        {
+            pool->misses = pool->misses + 1;
+        }
+        return NULL;
+    }
+    // the objects are only valid up to count, the header is cleared
+    memset(result, 0, offsetof(algo_result_t, objects));
+    result->pool = pool;
+    return result;
+}
+
+void algo_result_release(algo_result_t *result)
+{
+    if (result)
+    {
+        xQueueSend(result->pool->free, &result, 0);
+    }
+}
+
+uint32_t algo_result_pool_in_use(const algo_result_pool_t *pool)
+{
+    return pool->count - uxQueueMessagesWaiting(pool->free);
+}
+
+uint32_t algo_result_pool_misses(const algo_result_pool_t *pool)
+{
+    return pool->misses;
+}
+
+bool algo_result_add(algo_result_t *result, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint8_t confidence, uint8_t target)
+{
+    if (result->count >= ALGO_RESULT_MAX_OBJECTS)
+    {
+        result->lost++;
+        return false;
+    }
+    algo_object_t *object = &result->objects[result->count++];
+    object->x = x;
+    object->y = y;
+    object->w = w;
+    object->h = h;
+    object->confidence = confidence;
+    object->target = target;
+    object->id = 0;
+    return true;
+}
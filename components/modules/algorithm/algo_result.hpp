@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+/*
+ * Results of one frame, as the algorithms push them through their result
+ * queue: the queue carries algo_result_t pointers out of a fixed pool, so a
+ * consumer reads the objects in place and hands the record back with
+ * algo_result_release() once done. Nothing is allocated per frame.
+ */
+
+#define ALGO_RESULT_MAX_OBJECTS 32
+
+typedef struct
+{
+    uint16_t x;         /* centre, in frame pixels */
+    uint16_t y;
+    uint16_t w;         /* size, 0 for points and classes */
+    uint16_t h;
+    uint8_t confidence; /* % */
+    uint8_t target;     /* class index of the model */
+    uint16_t id;        /* track of the object across frames, 0 if not tracked */
+} algo_object_t;
+
+typedef struct algo_result_pool algo_result_pool_t;
+
+typedef struct
+{
+    const char *model;   /* model name, as in the debug output */
+    uint32_t frame;      /* frames taken by the algorithm before this one */
+    uint16_t width;      /* frame the coordinates refer to */
+    uint16_t height;
+    uint32_t preprocess_us;
+    uint32_t invoke_us;
+    uint32_t postprocess_us; /* up to the result being queued */
+    uint16_t count;      /* objects[] in use */
+    uint16_t lost;       /* objects found beyond ALGO_RESULT_MAX_OBJECTS */
+    uint16_t crops;      /* objects[] with a second-stage detail */
+    uint16_t skipped;    /* objects left without one by the per-frame cap */
+    algo_object_t objects[ALGO_RESULT_MAX_OBJECTS];
+    /* output of a cascade's second model on objects[i], confidence 0 for objects without one; only valid with crops */
+    algo_object_t details[ALGO_RESULT_MAX_OBJECTS];
+
+    algo_result_pool_t *pool; /* owner, for algo_result_release() */
+} algo_result_t;
+
+/**
+ * @brief Create a pool of result records
+ *
+ * @param count  records, the results a consumer can hold on to at once plus one being filled
+ * @return the pool, NULL if out of memory
+ */
+algo_result_pool_t *algo_result_pool_create(uint8_t count);
+
+/* a cleared record, NULL if every record is out */
+algo_result_t *algo_result_take(algo_result_pool_t *pool);
+
+/* hand a record back to its pool, NULL is ignored */
+void algo_result_release(algo_result_t *result);
+
+/* records taken but not released, and takes that found the pool empty */
+uint32_t algo_result_pool_in_use(const algo_result_pool_t *pool);
+uint32_t algo_result_pool_misses(const algo_result_pool_t *pool);
+
+/* append an object, false (and counted in lost) if the record is full */
+bool algo_result_add(algo_result_t *result, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint8_t confidence, uint8_t target);
@@ -1,60 +1,41 @@
 #include <math.h>
 #include <stdint.h>
-#include <forward_list>
+#include <stdlib.h>
 
 #include "algo_yolo.hpp"
+#include "algo_model.hpp"
 #include "yolo_model_data.h"
 
 #include "fb_gfx.h"
 #include "isp.h"
-#include "base64.h"
+#include "detect.h"
+#include "track.h"
+#include "app_camera.h"
 
 #include "esp_log.h"
 #include "esp_camera.h"
 #include "esp_heap_caps.h"
-#include "esp_timer.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
-#include "tensorflow/lite/micro/micro_interpreter.h"
-#include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-#include "tensorflow/lite/schema/schema_generated.h"
 
 static const char *TAG = "yolo";
 
-static QueueHandle_t xQueueFrameI = NULL;
-static QueueHandle_t xQueueEvent = NULL;
-static QueueHandle_t xQueueFrameO = NULL;
-static QueueHandle_t xQueueResult = NULL;
-
-static bool gEvent = true;
-static bool gReturnFB = true;
-static bool debug_mode = false;
-
 #define CONFIDENCE 25
 #define IOU 45
+// NMS candidates kept per class, enough for a crowded frame
+#define TOP_N 256
+// detections before a track is reported, detector frames it survives unmatched, % of overlap to match it
+#define TRACK_MIN_HITS 3
+#define TRACK_MAX_AGE 3
+#define TRACK_IOU 30
 
 const uint16_t box_color[] = {0x0000, 0xFFFF, 0x07E0, 0x001F, 0xF800, 0xF81F, 0xFFE0, 0x07FF, 0x07FF, 0x07FF, 0x07FF};
 
-std::forward_list<yolo_t> nms_get_obeject_topn(int8_t *dataset, uint16_t top_n, uint8_t threshold, uint8_t nms, uint16_t width, uint16_t height, int num_record, int8_t num_class, float scale, int zero_point);
-
-// Globals, used for compatibility with Arduino-style sketches.
 namespace
 {
-    const tflite::Model *model = nullptr;
-    tflite::MicroInterpreter *interpreter = nullptr;
-    TfLiteTensor *input = nullptr;
-    static std::forward_list<yolo_t> _yolo_list;
-
-    // In order to use optimized tensorflow lite kernels, a signed int8_t quantized
-    // model is preferred over the legacy unsigned model format. This means that
-    // throughout this project, input images must be converted from unisgned to
-    // signed format. The easiest and quickest way to convert from unsigned to
-    // signed 8-bit integers is to subtract 128 from the unsigned value to get a
-    // signed value.
-
 #ifdef CONFIG_IDF_TARGET_ESP32S3
     constexpr int scratchBufSize = 1024 * 1024;
 #else
@@ -62,195 +43,203 @@ namespace
 #endif
     // An area of memory to use for input, output, and intermediate arrays.
     constexpr int kTensorArenaSize = 256 * 1024 + scratchBufSize;
-    static uint8_t *tensor_arena; //[kTensorArenaSize]; // Maybe we should move this to external
-} //
+    // Tensor and op data, all the model keeps when the arena is shared (algo_arena_share()).
+    constexpr int kPersistentArenaSize = 96 * 1024;
 
-static void task_process_handler(void *arg)
-{
-    camera_fb_t *frame = NULL;
-
-    uint16_t h = input->dims->data[1];
-    uint16_t w = input->dims->data[2];
-    uint16_t c = input->dims->data[3];
-
-    while (true)
+    class Yolo : public VisionModel
     {
-        if (gEvent)
+    public:
+        explicit Yolo(QueueHandle_t results)
+            : VisionModel("yolo", g_yolo_model_data, kTensorArenaSize, results, kPersistentArenaSize)
         {
-            if (xQueueReceive(xQueueFrameI, &frame, portMAX_DELAY))
-            {
-
-                int dsp_start_time = esp_timer_get_time() / 1000;
-                _yolo_list.clear();
-
-                if (c == 1)
-                    rgb565_to_gray(input->data.uint8, frame->buf, frame->height, frame->width, h, w, ROTATION_UP);
-                else if (c == 3)
-                    rgb565_to_rgb888(input->data.uint8, frame->buf, frame->height, frame->width, h, w, ROTATION_UP);
-
-                // for (int i = 0; i < input->bytes; i++)
-                // {
-                //     frame->buf[i] = input->data.uint8[i];
-                // }
-
-                int dsp_end_time = esp_timer_get_time() / 1000;
-
-                if (debug_mode)
-                {
-                    printf("Begin output\n");
-                    printf("Format: {\"height\": %d, \"width\": %d, \"channels\": %d, \"model\": \"yolo\"}\r\n", h, w, c);
-                    printf("Framebuffer: ");
-                    base64_encode(input->data.uint8, input->bytes, putchar);
-                    printf("\r\n");
-                }
-
-                for (int i = 0; i < input->bytes; i++)
-                {
-                    input->data.int8[i] = input->data.uint8[i] - 128;
-                }
-
-                // Run the model on this input and make sure it succeeds.
-                int start_time = esp_timer_get_time() / 1000;
-
-                if (kTfLiteOk != interpreter->Invoke())
-                {
-                    MicroPrintf("Invoke failed.");
-                }
-
-                int end_time = esp_timer_get_time() / 1000;
-
-                vTaskDelay(10 / portTICK_PERIOD_MS);
-
-                TfLiteTensor *output = interpreter->output(0);
-
-                // Get the results of the inference attempt
-                float scale = ((TfLiteAffineQuantization *)(output->quantization.params))->scale->data[0];
-                int zero_point = ((TfLiteAffineQuantization *)(output->quantization.params))->zero_point->data[0];
-
-                uint32_t records = output->dims->data[1];
-                uint32_t num_class = output->dims->data[2] - OBJECT_T_INDEX;
-
-                _yolo_list = nms_get_obeject_topn(output->data.int8, records, CONFIDENCE, IOU, w, h, records, num_class, scale, zero_point);
-
-                printf("Predictions (DSP: %d ms., Classification: %d ms., Anomaly: %d ms.): \n", (dsp_end_time - dsp_start_time), (end_time - start_time), 0);
-                bool found = false;
+        }
 
-#if 0
-    for (int i = 0; i < records; i++)
-    {
-        float confidence = float(output->data.int8[i * num_element + OBJECT_C_INDEX] - zero_point) * scale;
-        if (confidence > .40)
+        int init(const tflite::MicroOpResolver &resolver, uint8_t slots = 1) override
         {
-            int8_t max = -128;
-            int target = 0;
-            for (int j = 0; j < num_class; j++)
+            if (VisionModel::init(resolver, slots) != 0)
             {
-                if (max < output->data.int8[i * num_element + OBJECT_T_INDEX + j])
-                {
-                    max = output->data.int8[i * num_element + OBJECT_T_INDEX + j];
-                    target = j;
-                }
+                return -1;
             }
-            int x = int(float(float(output->data.int8[i * num_element + OBJECT_X_INDEX] - zero_point) * scale) * frame->width);
-            int y = int(float(float(output->data.int8[i * num_element + OBJECT_Y_INDEX] - zero_point) * scale) * frame->height);
-            int w = int(float(float(output->data.int8[i * num_element + OBJECT_W_INDEX] - zero_point) * scale) * frame->width);
-            int h = int(float(float(output->data.int8[i * num_element + OBJECT_H_INDEX] - zero_point) * scale) * frame->height);
+#if CONFIG_ISP_YOLO_LETTERBOX
+            isp_config.letterbox = 1;
+            isp_config.pad = 114;
+            // staged inputs are only written by preprocess, each slot's padding once; an input
+            // tensor in the arena is reused during Invoke, so its padding is rewritten every frame
+            isp_config.keep_pad = staged();
+#endif
+            // the decoder is set up once for the model: its int8 threshold and its candidates
+            TfLiteTensor *out = interpreter->output(0);
+            const TfLiteAffineQuantization *quantization = (TfLiteAffineQuantization *)out->quantization.params;
+            config.num_record = out->dims->data[1];
+            config.num_class = out->dims->data[2] - OBJECT_T_INDEX;
+            config.scale = quantization->scale->data[0];
+            config.zero_point = quantization->zero_point->data[0];
+            config.width = input->dims->data[2];
+            config.height = input->dims->data[1];
+            config.threshold = CONFIDENCE;
+            config.iou = IOU;
+            config.binned = true;
+#if CONFIG_ALGO_YOLO_AGNOSTIC_NMS
+            config.agnostic = true;
+#endif
+#if CONFIG_ALGO_YOLO_NMS_LINEAR
+            config.nms = DETECT_NMS_LINEAR;
+#elif CONFIG_ALGO_YOLO_NMS_GAUSSIAN
+            config.nms = DETECT_NMS_GAUSSIAN;
+            config.sigma = CONFIG_ALGO_YOLO_NMS_SIGMA;
+#endif
+            detect_prepare(&config);
 
-            printf("index: %d target: %d max: %d confidence: %d box{x: %d, y: %d, w: %d, h: %d}\n", i, target, max, int((float)confidence * 100), x, y, w, h);
-        }
-    }
+            size_t size = detect_workspace_size(config.num_class, TOP_N);
+            workspace_buffer = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (detect_workspace_init(&workspace, workspace_buffer, size, config.num_class, TOP_N) != 0)
+            {
+                ESP_LOGE(TAG, "No memory for %u NMS candidates", (unsigned)(config.num_class * TOP_N));
+                return -1;
+            }
+#if CONFIG_ALGO_YOLO_TRACKER
+#if CONFIG_ALGO_YOLO_TRACK_HUNGARIAN
+            tracker_init(&tracker, TRACK_MIN_HITS, TRACK_MAX_AGE, TRACK_IOU, TRACK_HUNGARIAN);
+#else
+            tracker_init(&tracker, TRACK_MIN_HITS, TRACK_MAX_AGE, TRACK_IOU, TRACK_GREEDY);
+#endif
 #endif
+            return 0;
+        }
 
-                if (std::distance(_yolo_list.begin(), _yolo_list.end()) > 0)
-                {
-                    int index = 0;
-                    found = true;
-                    printf("    Objects found: %d\n", std::distance(_yolo_list.begin(), _yolo_list.end()));
-                    printf("    Objects:\n");
-                    printf("    [\n");
-                    for (auto &yolo : _yolo_list)
-                    {
-                        yolo.x = uint16_t(float(yolo.x) / float(w) * float(frame->width));
-                        yolo.y = uint16_t(float(yolo.y) / float(h) * float(frame->height));
-                        yolo.w = uint16_t(float(yolo.w) / float(w) * float(frame->width));
-                        yolo.h = uint16_t(float(yolo.h) / float(h) * float(frame->height));
-                        fb_gfx_drawRect2(frame, yolo.x - yolo.w / 2, yolo.y - yolo.h / 2, yolo.w, yolo.h, box_color[index % (sizeof(box_color) / sizeof(box_color[0]))], 4);
-                        // fb_gfx_printf(frame, yolo.x - yolo.w / 2, yolo.y - yolo.h/2 - 5, 0x1FE0, 0x0000, "%s", g_yolo_model_classes[yolo.target]);
-                        printf("        {\"class\": \"%d\", \"x\": %d, \"y\": %d, \"w\": %d, \"h\": %d, \"confidence\": %d},\n", yolo.target, yolo.x, yolo.y, yolo.w, yolo.h, yolo.confidence);
-                        index++;
-                    }
-                    printf("    ]\n");
-                }
+    protected:
+        void process_output(camera_fb_t *frame, TfLiteTensor *output, const isp_transform_t *transform,
+                            algo_result_t *result) override
+        {
+            int found = 0;
+            int count = detect_yolo(output->data.int8, &config, &workspace, boxes, ALGO_RESULT_MAX_OBJECTS, &found);
 
-                if (!found)
-                {
-                    printf("    No objects found\n");
-                }
-                if (debug_mode)
+            for (int i = 0; i < count; i++)
+            {
+                // undo the resize (and letterbox) of the input, boxes are centre + size
+                detect_box_t &yolo = boxes[i];
+                int x = isp_source_x(transform, yolo.x);
+                int y = isp_source_y(transform, yolo.y);
+                int bw = isp_source_w(transform, yolo.w);
+                int bh = isp_source_h(transform, yolo.h);
+                yolo.x = uint16_t(x < 0 ? 0 : (x > int(frame->width) ? frame->width : x));
+                yolo.y = uint16_t(y < 0 ? 0 : (y > int(frame->height) ? frame->height : y));
+                yolo.w = uint16_t(bw > int(frame->width) ? frame->width : bw);
+                yolo.h = uint16_t(bh > int(frame->height) ? frame->height : bh);
+            }
+#if CONFIG_ALGO_YOLO_TRACKER
+            // the boxes go out as the tracks corrected by them, tracks not yet confirmed hold theirs back
+            int n = tracker_update(&tracker, boxes, count, tracks, TRACK_MAX);
+            track_stable = tracker_stable(&tracker);
+            add_tracks(tracks, n, result);
+            // the least confident detections did not fit the decoder, or the tracker
+            result->lost += found - (count < TRACK_MAX ? count : TRACK_MAX);
+#else
+            if (count > 0)
+            {
+                EVLOG(&log, "    Objects found: %d\n", EVLOG_I(found));
+                EVLOG(&log, "    Objects:\n");
+                EVLOG(&log, "    [\n");
+                for (int i = 0; i < count; i++)
                 {
-                    printf("End output\n");
+                    const detect_box_t &yolo = boxes[i];
+                    EVLOG(&log, "        {\"class\": \"%d\", \"x\": %d, \"y\": %d, \"w\": %d, \"h\": %d, \"confidence\": %d},\n",
+                          EVLOG_I(yolo.target), EVLOG_I(yolo.x), EVLOG_I(yolo.y), EVLOG_I(yolo.w), EVLOG_I(yolo.h), EVLOG_I(yolo.confidence));
+                    algo_result_add(result, yolo.x, yolo.y, yolo.w, yolo.h, yolo.confidence, yolo.target);
                 }
+                // the least confident ones did not fit
+                result->lost += found - count;
+                EVLOG(&log, "    ]\n");
+            }
+            else
+            {
+                EVLOG(&log, "    No objects found\n");
             }
+#endif
+        }
 
-            if (xQueueFrameO)
+#if CONFIG_ALGO_YOLO_TRACKER
+        bool predict_frame() override
+        {
+            // preprocess may run a frame ahead of postprocess, so this reads the tracks of the frame before
+            if (!track_stable)
             {
-                xQueueSend(xQueueFrameO, &frame, portMAX_DELAY);
+                track_frames = 0;
+                return false;
             }
-            else if (gReturnFB)
+            return ++track_frames % CONFIG_ALGO_YOLO_TRACK_INTERVAL != 0;
+        }
+
+        bool predict_output(camera_fb_t *frame, algo_result_t *result) override
+        {
+            int n = tracker_predict(&tracker, tracks, TRACK_MAX);
+            for (int i = 0; i < n; i++)
             {
-                esp_camera_fb_return(frame);
+                detect_box_t &box = tracks[i].box;
+                box.x = box.x > frame->width ? frame->width : box.x;
+                box.y = box.y > frame->height ? frame->height : box.y;
             }
-            else
+            add_tracks(tracks, n, result);
+            return true;
+        }
+
+        /* the reported tracks into result, and the log; algo_result_add() counts those that don't fit as lost */
+        void add_tracks(const track_object_t *objects, int n, algo_result_t *result)
+        {
+            if (n == 0)
+            {
+                EVLOG(&log, "    No objects found\n");
+                return;
+            }
+            EVLOG(&log, "    Objects found: %d\n", EVLOG_I(n));
+            EVLOG(&log, "    Objects:\n");
+            EVLOG(&log, "    [\n");
+            for (int i = 0; i < n; i++)
             {
-                free(frame);
+                const detect_box_t &box = objects[i].box;
+                EVLOG(&log, "        {\"class\": \"%d\", \"x\": %d, \"y\": %d, \"w\": %d, \"h\": %d, \"confidence\": %d, \"id\": %d},\n",
+                      EVLOG_I(box.target), EVLOG_I(box.x), EVLOG_I(box.y), EVLOG_I(box.w), EVLOG_I(box.h), EVLOG_I(box.confidence),
+                      EVLOG_I(objects[i].id));
+                if (algo_result_add(result, box.x, box.y, box.w, box.h, box.confidence, box.target))
+                {
+                    result->objects[result->count - 1].id = objects[i].id;
+                }
             }
+            EVLOG(&log, "    ]\n");
+        }
+#endif
 
-            if (xQueueResult)
+        void draw_result(camera_fb_t *frame, const algo_result_t *result) override
+        {
+            for (uint16_t i = 0; i < result->count; i++)
             {
-                xQueueSend(xQueueResult, NULL, portMAX_DELAY);
+                const algo_object_t &box = result->objects[i];
+                fb_gfx_drawRect2(frame, box.x - box.w / 2, box.y - box.h / 2, box.w, box.h, box_color[i % (sizeof(box_color) / sizeof(box_color[0]))], 4);
+                // fb_gfx_printf(frame, box.x - box.w / 2, box.y - box.h/2 - 5, 0x1FE0, 0x0000, "%s", g_yolo_model_classes[box.target]);
             }
         }
-    }
-}
 
-static void task_event_handler(void *arg)
-{
-    while (true)
-    {
-        xQueueReceive(xQueueEvent, &(gEvent), portMAX_DELAY);
-    }
-}
+    private:
+        detect_config_t config = {};
+        detect_workspace_t workspace = {};
+        void *workspace_buffer = nullptr;
+        detect_box_t boxes[ALGO_RESULT_MAX_OBJECTS];
+#if CONFIG_ALGO_YOLO_TRACKER
+        tracker_t tracker;
+        track_object_t tracks[TRACK_MAX];
+        volatile bool track_stable = false; // read by preprocess, maybe on the other core
+        uint32_t track_frames = 0;          // frames since the tracks became stable, counted by preprocess
+#endif
+    };
+} //
 
-int register_algo_yolo(const QueueHandle_t frame_i,
-                       const QueueHandle_t event,
-                       const QueueHandle_t result,
-                       const QueueHandle_t frame_o,
-                       const bool camera_fb_return)
+VisionModel *yolo_model(QueueHandle_t results, uint8_t slots)
 {
-    xQueueFrameI = frame_i;
-    xQueueFrameO = frame_o;
-    xQueueEvent = event;
-    xQueueResult = result;
-    gReturnFB = camera_fb_return;
-
-    // get model (.tflite) from flash
-    model = tflite::GetModel(g_yolo_model_data);
-    if (model->version() != TFLITE_SCHEMA_VERSION)
+    static Yolo yolo(results);
+    static bool loaded = false;
+    if (loaded)
     {
-        MicroPrintf("Model provided is schema version %d not equal to supported "
-                    "version %d.",
-                    model->version(), TFLITE_SCHEMA_VERSION);
-        return -1;
-    }
-
-    if (tensor_arena == NULL)
-    {
-        tensor_arena = (uint8_t *)heap_caps_malloc(kTensorArenaSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    }
-    if (tensor_arena == NULL)
-    {
-        printf("Couldn't allocate memory of %d bytes\n", kTensorArenaSize);
-        return -1;
+        return &yolo;
     }
 
     static tflite::MicroMutableOpResolver<18> micro_op_resolver;
@@ -273,206 +262,30 @@ int register_algo_yolo(const QueueHandle_t frame_i,
     micro_op_resolver.AddStridedSlice();
     micro_op_resolver.AddResizeNearestNeighbor();
 
-    // Build an interpreter to run the model with.
-    // NOLINTNEXTLINE(runtime-global-variables)
-    static tflite::MicroInterpreter static_interpreter(
-        model, micro_op_resolver, tensor_arena, kTensorArenaSize);
-    interpreter = &static_interpreter;
-
-    // Allocate memory from the tensor_arena for the model's tensors.
-    TfLiteStatus allocate_status = interpreter->AllocateTensors();
-    if (allocate_status != kTfLiteOk)
+    if (yolo.init(micro_op_resolver, slots) != 0)
     {
-        MicroPrintf("AllocateTensors() failed");
-        return -1;
+        return nullptr;
     }
-
-    // Get information about the memory area to use for the model's input.
-    input = interpreter->input(0);
-
-    xTaskCreatePinnedToCore(task_process_handler, TAG, 4 * 1024, NULL, 5, NULL, 0);
-    if (xQueueEvent)
-        xTaskCreatePinnedToCore(task_event_handler, TAG, 4 * 1024, NULL, 5, NULL, 1);
-
-    return 0;
-}
-
-#define CLIP(x, y, z) (x < y) ? y : ((x > z) ? z : x)
-
-static bool _object_comparator_reverse(yolo_t &oa, yolo_t &ob)
-{
-    return oa.confidence < ob.confidence;
-}
-
-static bool _object_nms_comparator(yolo_t &oa, yolo_t &ob)
-{
-    return oa.confidence > ob.confidence;
-}
-
-static bool _object_comparator(yolo_t &oa, yolo_t &ob)
-{
-    return oa.x > ob.x;
+    loaded = true;
+    return &yolo;
 }
 
-bool _object_remove(yolo_t &obj)
-{
-    return (obj.confidence == 0);
-}
-
-static uint16_t _overlap(float x1, float w1, float x2, float w2)
-{
-    uint16_t l1 = x1 - w1 / 2;
-    uint16_t l2 = x2 - w2 / 2;
-    uint16_t left = l1 > l2 ? l1 : l2;
-    uint16_t r1 = x1 + w1 / 2;
-    uint16_t r2 = x2 + w2 / 2;
-    uint16_t right = r1 < r2 ? r1 : r2;
-    return right - left;
-}
-
-void _soft_nms_obeject_detection(std::forward_list<yolo_t> &yolo_obj_list, uint8_t nms)
+int register_algo_yolo(const QueueHandle_t frame_i,
+                       const QueueHandle_t event,
+                       const QueueHandle_t result,
+                       const QueueHandle_t frame_o,
+                       const bool camera_fb_return)
 {
-    std::forward_list<yolo_t>::iterator max_box_obj;
-    yolo_obj_list.sort(_object_nms_comparator);
-    for (std::forward_list<yolo_t>::iterator it = yolo_obj_list.begin(); it != yolo_obj_list.end(); ++it)
+    pipeline::Config config = vision_config(TAG, 4 * 1024);
+    VisionModel *yolo = yolo_model(result, config.slots);
+    if (yolo == nullptr)
     {
-        uint16_t area = it->w * it->h;
-        for (std::forward_list<yolo_t>::iterator itc = std::next(it, 1); itc != yolo_obj_list.end(); ++itc)
-        {
-            if (itc->confidence == 0)
-            {
-                continue;
-            }
-            uint16_t iw = _overlap(itc->x, itc->w, it->x, it->w);
-            if (iw > 0)
-            {
-                uint16_t ih = _overlap(itc->y, itc->h, it->y, it->h);
-                if (ih > 0)
-                {
-                    float ua = float(itc->w * itc->h + area - iw * ih);
-                    float ov = iw * ih / ua;
-                    if (int(float(ov) * 100) >= nms)
-                    {
-                        itc->confidence = 0;
-                    }
-                }
-            }
-        }
+        return -1;
     }
-    yolo_obj_list.remove_if(_object_remove);
-    return;
-}
 
-void _hard_nms_obeject_count(std::forward_list<yolo_t> &yolo_obj_list, uint8_t nms)
-{
-    std::forward_list<yolo_t>::iterator max_box_obj;
-    yolo_obj_list.sort(_object_nms_comparator);
-    for (std::forward_list<yolo_t>::iterator it = yolo_obj_list.begin(); it != yolo_obj_list.end(); ++it)
-    {
-        uint16_t area = it->w * it->h;
-        for (std::forward_list<yolo_t>::iterator itc = std::next(it, 1); itc != yolo_obj_list.end(); ++itc)
-        {
-            if (itc->confidence == 0)
-            {
-                continue;
-            }
-            uint16_t iw = _overlap(itc->x, itc->w, it->x, it->w);
-            if (iw > 0)
-            {
-                uint16_t ih = _overlap(itc->y, itc->h, it->y, it->h);
-                if (ih > 0)
-                {
-                    float ua = float(itc->w * itc->h + area - iw * ih);
-                    float ov = iw * ih / ua;
-                    if (int(float(ov) * 100) >= nms)
-                    {
-                        itc->confidence = 0;
-                    }
-                }
-            }
-        }
-    }
-    yolo_obj_list.remove_if(_object_remove);
+    static pipeline::QueueSource camera(frame_i, camera_fb_return ? camera_frame_return : nullptr);
+    static pipeline::QueueSink display(frame_o);
+    static pipeline::Pipeline algo(*yolo, camera, frame_o ? &display : nullptr);
 
-    return;
+    return algo.start(config, event);
 }
-
-std::forward_list<yolo_t> nms_get_obeject_topn(int8_t *dataset, uint16_t top_n, uint8_t threshold, uint8_t nms, uint16_t width, uint16_t height, int num_record, int8_t num_class, float scale, int zero_point)
-{
-    bool rescale = scale < 0.1 ? true : false;
-    std::forward_list<yolo_t> yolo_obj_list[num_class];
-    int16_t num_obj[num_class] = {0};
-    int16_t num_element = num_class + OBJECT_T_INDEX;
-    for (int i = 0; i < num_record; i++)
-    {
-        float confidence = float(dataset[i * num_element + OBJECT_C_INDEX] - zero_point) * scale;
-        confidence = rescale ? confidence * 100 : confidence;
-        if (int(float(confidence)) >= threshold)
-        {
-            yolo_t obj;
-            int8_t max = -128;
-            obj.target = 0;
-
-            for (int j = 0; j < num_class; j++)
-            {
-                if (max < dataset[i * num_element + OBJECT_T_INDEX + j])
-                {
-                    max = dataset[i * num_element + OBJECT_T_INDEX + j];
-                    obj.target = j;
-                }
-            }
-
-            float x = float(dataset[i * num_element + OBJECT_X_INDEX] - zero_point) * scale;
-            float y = float(dataset[i * num_element + OBJECT_Y_INDEX] - zero_point) * scale;
-            float w = float(dataset[i * num_element + OBJECT_W_INDEX] - zero_point) * scale;
-            float h = float(dataset[i * num_element + OBJECT_H_INDEX] - zero_point) * scale;
-
-            if (rescale)
-            {
-                obj.x = CLIP(int(x * width), 0, width);
-                obj.y = CLIP(int(y * height), 0, height);
-                obj.w = CLIP(int(w * width), 0, width);
-                obj.h = CLIP(int(h * height), 0, height);
-            }
-            else
-            {
-                obj.x = CLIP(int(x), 0, width);
-                obj.y = CLIP(int(y), 0, height);
-                obj.w = CLIP(int(w), 0, width);
-                obj.h = CLIP(int(h), 0, height);
-            }
-            obj.w = (obj.x + obj.w) > width ? (width - obj.x) : obj.w;
-            obj.h = (obj.y + obj.h) > height ? (height - obj.y) : obj.h;
-            obj.confidence = confidence;
-            if (num_obj[obj.target] >= top_n)
-            {
-                yolo_obj_list[obj.target].sort(_object_comparator_reverse);
-                if (obj.confidence > yolo_obj_list[obj.target].front().confidence)
-                {
-                    yolo_obj_list[obj.target].pop_front();
-                    yolo_obj_list[obj.target].emplace_front(obj);
-                }
-            }
-            else
-            {
-                yolo_obj_list[obj.target].emplace_front(obj);
-                num_obj[obj.target]++;
-            }
-        }
-    }
-
-    std::forward_list<yolo_t> result;
-
-    for (int i = 0; i < num_class; i++)
-    {
-        if (!yolo_obj_list[i].empty())
-        {
-            _soft_nms_obeject_detection(yolo_obj_list[i], nms);
-            result.splice_after(result.before_begin(), yolo_obj_list[i]);
-        }
-    }
-
-    result.sort(_object_comparator); // left to right
-
-    return result;
-}
\ No newline at end of file
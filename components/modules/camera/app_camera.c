@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 
 #include "app_camera.h"
+#include "isp.h"
 
 #include "esp_log.h"
 #include "esp_system.h"
@@ -21,21 +22,39 @@ limitations under the License.
 static const char *TAG = "app_camera";
 
 static QueueHandle_t xQueueFrameO = NULL;
+static camera_delivery_t gDelivery = CAMERA_DELIVER_EVERY_FRAME;
+static volatile camera_stats_t gStats;
 
 static void task_process_handler(void *arg)
 {
   while (true)
   {
     camera_fb_t *frame = esp_camera_fb_get();
-    if (frame)
-      xQueueSend(xQueueFrameO, &frame, portMAX_DELAY);
+    if (!frame)
+      continue;
+    gStats.captured++;
+
+    if (gDelivery == CAMERA_DELIVER_LATEST)
+    {
+      // whatever is still queued is older than this frame, give it back so
+      // the driver has a buffer for the next one
+      camera_fb_t *stale = NULL;
+      while (xQueueReceive(xQueueFrameO, &stale, 0) == pdTRUE)
+      {
+        esp_camera_fb_return(stale);
+        gStats.dropped++;
+      }
+    }
+    xQueueSend(xQueueFrameO, &frame, portMAX_DELAY);
+    gStats.delivered++;
   }
 }
 
 void      register_camera(const pixformat_t pixel_fromat,
                      const framesize_t frame_size,
                      const uint8_t fb_count,
-                     const QueueHandle_t frame_o)
+                     const QueueHandle_t frame_o,
+                     const camera_delivery_t delivery)
 {
   ESP_LOGI(TAG, "Camera module is %s", CAMERA_MODULE_NAME);
 
@@ -79,7 +98,8 @@ void      register_camera(const pixformat_t pixel_fromat,
   config.jpeg_quality = 12;
   config.fb_count = fb_count;
   config.fb_location = CAMERA_FB_IN_PSRAM;
-  config.grab_mode = CAMERA_GRAB_WHEN_EMPTY;
+  // the driver itself keeps overwriting its oldest buffer too, so a frame is never older than one period
+  config.grab_mode = delivery == CAMERA_DELIVER_LATEST && fb_count > 1 ? CAMERA_GRAB_LATEST : CAMERA_GRAB_WHEN_EMPTY;
 
   // camera init
   esp_err_t err = esp_camera_init(&config);
@@ -99,5 +119,61 @@ void      register_camera(const pixformat_t pixel_fromat,
   }
 
   xQueueFrameO = frame_o;
+  gDelivery = delivery;
   xTaskCreatePinnedToCore(task_process_handler, TAG, 2 * 1024, NULL, 5, NULL, 1);
 }
+
+void camera_get_stats(camera_stats_t *stats)
+{
+  stats->captured = gStats.captured;
+  stats->delivered = gStats.delivered;
+  stats->dropped = gStats.dropped;
+}
+
+pixformat_t camera_pixformat(uint8_t channels)
+{
+  return channels == 1 ? PIXFORMAT_YUV422 : PIXFORMAT_RGB565;
+}
+
+uint8_t camera_isp_format(const camera_fb_t *frame)
+{
+  switch (frame->format)
+  {
+  case PIXFORMAT_RGB565:
+    return ISP_FORMAT_RGB565;
+  case PIXFORMAT_YUV422:
+    return ISP_FORMAT_YUV422;
+  case PIXFORMAT_GRAYSCALE:
+    return ISP_FORMAT_GRAY;
+  default:
+    return 0xFF;
+  }
+}
+
+int camera_frame_rows(void *frame, int rows)
+{
+  // esp_camera_fb_get() only hands out frames once the DMA has written the
+  // last line, so every row is already there. A capture path that reports
+  // its line progress plugs in here.
+  return ((camera_fb_t *)frame)->height;
+}
+
+void camera_frame_return(void *frame)
+{
+  esp_camera_fb_return((camera_fb_t *)frame);
+}
+
+int camera_convert(void *pdst, camera_fb_t *frame, isp_config_t *config, jpeg_decoder_t *jpeg)
+{
+  if (frame->format == PIXFORMAT_JPEG)
+    return jpeg_convert(pdst, frame->buf, frame->len, config, jpeg);
+
+  config->format = camera_isp_format(frame);
+  if (config->format == 0xFF)
+    return -1;
+  config->h = frame->height;
+  config->w = frame->width;
+  config->source_rows = camera_frame_rows;
+  config->source_ctx = frame;
+  return isp_convert(pdst, frame->buf, config);
+}
@@ -7,6 +7,8 @@
 
 #include "esp_camera.h"
 
+#include "jpeg.h"
+
 #if CONFIG_CAMERA_MODULE_WROVER_KIT
 #define CAMERA_MODULE_NAME "Wrover Kit"
 #define CAMERA_PIN_PWDN -1
@@ -221,6 +223,20 @@
 extern "C"
 {
 #endif
+    /* how register_camera() hands frames to the queue when the consumer falls behind */
+    typedef enum
+    {
+        CAMERA_DELIVER_EVERY_FRAME = 0, /* queue every frame, the camera waits for room */
+        CAMERA_DELIVER_LATEST,          /* keep only the newest frame queued, older ones go straight back */
+    } camera_delivery_t;
+
+    typedef struct
+    {
+        uint32_t captured;  /* frames from the driver */
+        uint32_t delivered; /* frames queued */
+        uint32_t dropped;   /* queued frames replaced by a newer one before they were taken */
+    } camera_stats_t;
+
     /**
      * @brief Initialize camera
      *
@@ -257,11 +273,65 @@ extern "C"
      *                     - FRAMESIZE_P_FHD,    // 1080x1920
      *                     - FRAMESIZE_QSXGA,    // 2560x1920
      * @param fb_count     Number of frame buffers to be allocated. If more than one, then each frame will be acquired (double speed)
+     * @param frame_o      queue of camera_fb_t * the frames go to
+     * @param delivery     CAMERA_DELIVER_LATEST trades frames for latency: the consumer always
+     *                     gets the newest frame and the driver always has a buffer to fill
      */
     void register_camera(const pixformat_t pixel_fromat,
                          const framesize_t frame_size,
                          const uint8_t fb_count,
-                         const QueueHandle_t frame_o);
+                         const QueueHandle_t frame_o,
+                         const camera_delivery_t delivery);
+
+    /* counters since register_camera() */
+    void camera_get_stats(camera_stats_t *stats);
+
+    /**
+     * @brief Capture format for a model input
+     *
+     * Grayscale models read the luma straight out of packed YUV422, so their
+     * conversion is a strided copy. Colour models and the LCD want RGB565.
+     *
+     * @param channels  channels of the model input
+     * @return PIXFORMAT_YUV422 for 1 channel, PIXFORMAT_RGB565 otherwise
+     */
+    pixformat_t camera_pixformat(uint8_t channels);
+
+    /* ISP_FORMAT_* of a camera frame, 0xFF if isp cannot read it */
+    uint8_t camera_isp_format(const camera_fb_t *frame);
+
+    /**
+     * @brief Line source of the frames handed out by register_camera()
+     *
+     * Matches isp_source_rows_t with the camera_fb_t as context, so the ISP
+     * converts a frame stripe by stripe while it is still being captured. It
+     * blocks until at least `rows` rows are in the frame buffer and returns
+     * how many are.
+     *
+     * @param frame  camera_fb_t received from the frame queue
+     * @param rows   rows needed by the next output row
+     * @return rows of the frame in memory
+     */
+    int camera_frame_rows(void *frame, int rows);
+
+    /* esp_camera_fb_return() for frames passed around as void * */
+    void camera_frame_return(void *frame);
+
+    /**
+     * @brief Convert a camera frame into a model input
+     *
+     * Raw frames go through isp_convert() with the format, size and line
+     * source of the frame filled in; PIXFORMAT_JPEG frames are decoded with
+     * jpeg_convert(), which needs a fraction of the frame buffer memory and
+     * bus bandwidth at the cost of the entropy decoding.
+     *
+     * @param pdst    model input
+     * @param frame   camera_fb_t received from the frame queue
+     * @param config  isp job of the call site
+     * @param jpeg    decoder of the call site, only used for JPEG frames
+     * @return 0 on success, -1 on an unsupported frame format or a failed conversion
+     */
+    int camera_convert(void *pdst, camera_fb_t *frame, isp_config_t *config, jpeg_decoder_t *jpeg);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+
+#include "algo_result.hpp"
+
+TEST_CASE("result pool hands out every record once", "[algo]")
+{
+    algo_result_pool_t *pool = algo_result_pool_create(3);
+    TEST_ASSERT_NOT_NULL(pool);
+
+    algo_result_t *results[3];
+    for (int i = 0; i < 3; i++)
+    {
+        results[i] = algo_result_take(pool);
+        TEST_ASSERT_NOT_NULL(results[i]);
+        for (int j = 0; j < i; j++)
+        {
+            TEST_ASSERT(results[i] != results[j]);
+        }
+    }
+    TEST_ASSERT_EQUAL(3, algo_result_pool_in_use(pool));
+    TEST_ASSERT_NULL(algo_result_take(pool));
+    TEST_ASSERT_EQUAL(1, algo_result_pool_misses(pool));
+
+    algo_result_release(results[1]);
+    algo_result_release(NULL);
+    TEST_ASSERT_EQUAL(2, algo_result_pool_in_use(pool));
+    TEST_ASSERT(algo_result_take(pool) == results[1]);
+}
+
+TEST_CASE("result record keeps what fits and counts the rest", "[algo]")
+{
+    algo_result_pool_t *pool = algo_result_pool_create(1);
+    algo_result_t *result = algo_result_take(pool);
+
+    for (int i = 0; i < ALGO_RESULT_MAX_OBJECTS + 5; i++)
+    {
+        TEST_ASSERT_EQUAL(i < ALGO_RESULT_MAX_OBJECTS, algo_result_add(result, i, i + 1, 4, 5, 90, i % 3));
+    }
+    TEST_ASSERT_EQUAL(ALGO_RESULT_MAX_OBJECTS, result->count);
+    TEST_ASSERT_EQUAL(5, result->lost);
+    TEST_ASSERT_EQUAL(7, result->objects[7].x);
+    TEST_ASSERT_EQUAL(8, result->objects[7].y);
+    TEST_ASSERT_EQUAL(1, result->objects[7].target);
+
+    // a record comes back cleared
+    result->frame = 42;
+    algo_result_release(result);
+    result = algo_result_take(pool);
+    TEST_ASSERT_EQUAL(0, result->count);
+    TEST_ASSERT_EQUAL(0, result->lost);
+    TEST_ASSERT_EQUAL(0, result->frame);
+    TEST_ASSERT(result->pool == pool);
+}
@@ -0,0 +1,519 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pipeline.hpp"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_timer.h"
+#endif
+
+namespace pipeline
+{
+    /*
+     * A stage that always finds work waiting never blocks, which starves the
+     * idle task of its core and trips the task watchdog. Such a stage gives up
+     * one tick after this long without blocking.
+     */
+    static const int64_t kIdlePeriod = 1000 * 1000;
+
+    /* bits of Pipeline::controls */
+    static const EventBits_t kRun = 1 << 0;
+    static const EventBits_t kSingleShot = 1 << 1;
+    static const EventBits_t kStop = 1 << 2;
+
+    static void keep_idle_alive(int64_t &idle)
+    {
+        if (now() - idle > kIdlePeriod)
+        {
+            vTaskDelay(1);
+            idle = now();
+        }
+    }
+
+    /* the core to pin a stage to, single core chips (and the linux target) run everything on core 0 */
+    static BaseType_t stage_core(int8_t core)
+    {
+        if (core < 0)
+        {
+            return tskNO_AFFINITY;
+        }
+        return core < portNUM_PROCESSORS ? core : 0;
+    }
+
+    /* receive from a stage queue, noting when the stage is about to block */
+    static void receive(QueueHandle_t queue, void *item, int64_t &idle)
+    {
+        if (uxQueueMessagesWaiting(queue) == 0)
+        {
+            idle = now();
+        }
+        xQueueReceive(queue, item, portMAX_DELAY);
+    }
+
+    Config default_config(const char *name, uint32_t stack)
+    {
+        Config config = {};
+        config.name = name;
+        config.slots = 1;
+        config.policy = POLICY_EVERY_FRAME;
+        config.stats_interval = 0;
+        for (int i = 0; i < STAGE_COUNT; i++)
+        {
+            config.stages[i].depth = 1;
+            config.stages[i].core = 0;
+            config.stages[i].priority = 5;
+            config.stages[i].stack = stack;
+        }
+        return config;
+    }
+
+    Config pipelined_config(const char *name, uint32_t stack)
+    {
+        Config config = default_config(name, stack);
+        config.slots = 2;
+        config.stages[STAGE_PREPROCESS].core = 1;
+        config.stages[STAGE_POSTPROCESS].core = 1;
+        return config;
+    }
+
+    int64_t now()
+    {
+#if CONFIG_IDF_TARGET_LINUX
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+#else
+        return esp_timer_get_time();
+#endif
+    }
+
+    void Latency::add(int64_t us)
+    {
+        count++;
+        total += us;
+        max = us > max ? us : max;
+    }
+
+    QueueSource::QueueSource(QueueHandle_t queue, void (*release_frame)(void *frame))
+        : queue(queue), release_frame(release_frame)
+    {
+    }
+
+    void *QueueSource::acquire(TickType_t wait)
+    {
+        void *frame = nullptr;
+        if (xQueueReceive(queue, &frame, wait) != pdTRUE)
+        {
+            return nullptr;
+        }
+        return frame;
+    }
+
+    uint32_t QueueSource::waiting() const
+    {
+        return uxQueueMessagesWaiting(queue);
+    }
+
+    void QueueSource::release(void *frame)
+    {
+        if (release_frame)
+        {
+            release_frame(frame);
+        }
+    }
+
+    QueueSink::QueueSink(QueueHandle_t queue) : queue(queue)
+    {
+    }
+
+    void QueueSink::consume(void *frame)
+    {
+        xQueueSend(queue, &frame, portMAX_DELAY);
+    }
+
+    Pipeline::Pipeline(Model &model, Source &source, Sink *sink)
+        : model(model), source(source), sink(sink), config(), jobs(nullptr), free_jobs(nullptr), queues{},
+          event(nullptr), stopped(nullptr), stats_lock(nullptr), controls(nullptr), event_handle(nullptr),
+          running(false), seq(0), counters()
+    {
+    }
+
+    Pipeline::~Pipeline()
+    {
+        stop();
+        if (stats_lock)
+        {
+            vSemaphoreDelete(stats_lock);
+        }
+        if (controls)
+        {
+            vEventGroupDelete(controls);
+        }
+    }
+
+    int Pipeline::start(const Config &config, QueueHandle_t event, Control initial)
+    {
+        static const TaskFunction_t tasks[STAGE_COUNT] = {preprocess_task, invoke_task, postprocess_task};
+
+        if (running)
+        {
+            return -1;
+        }
+
+        this->config = config;
+        uint8_t slots = config.slots < model.slots() ? config.slots : model.slots();
+        slots = slots ? slots : 1;
+
+        // preprocess takes its frames from the source, the other stages from the queue in front of them
+        jobs = (Job *)calloc(slots, sizeof(Job));
+        free_jobs = xQueueCreate(slots, sizeof(Job *));
+        stopped = xSemaphoreCreateBinary();
+        if (stats_lock == nullptr)
+        {
+            stats_lock = xSemaphoreCreateMutex();
+        }
+        if (controls == nullptr)
+        {
+            controls = xEventGroupCreate();
+        }
+        bool ok = jobs && free_jobs && stopped && stats_lock && controls;
+        for (int i = STAGE_INVOKE; i < STAGE_COUNT && ok; i++)
+        {
+            queues[i] = xQueueCreate(config.stages[i].depth ? config.stages[i].depth : 1, sizeof(Job *));
+            ok = queues[i] != nullptr;
+        }
+        if (!ok)
+        {
+            release_queues();
+            return -1;
+        }
+        for (uint8_t i = 0; i < slots; i++)
+        {
+            Job *job = &jobs[i];
+            job->slot = i;
+            xQueueSend(free_jobs, &job, 0);
+        }
+
+        running = true;
+        seq = 0;
+        reset_stats();
+        xEventGroupClearBits(controls, kRun | kSingleShot | kStop);
+        control(initial);
+        // downstream first, so every stage has its consumer when the first frame arrives
+        for (int i = STAGE_COUNT - 1; i >= 0; i--)
+        {
+            const StageConfig &stage = config.stages[i];
+            xTaskCreatePinnedToCore(tasks[i], config.name, stage.stack, this, stage.priority, NULL,
+                                    stage_core(stage.core));
+        }
+
+        this->event = event;
+        if (event)
+        {
+            xTaskCreatePinnedToCore(event_task, config.name, 2 * 1024, this, 5, &event_handle, stage_core(1));
+        }
+        return 0;
+    }
+
+    void Pipeline::stop()
+    {
+        if (!running)
+        {
+            return;
+        }
+        if (event_handle)
+        {
+            vTaskDelete(event_handle);
+            event_handle = nullptr;
+        }
+        // preprocess sees this within one acquire timeout, or at once if paused,
+        // and sends the end of the stream down the stages
+        xEventGroupSetBits(controls, kStop);
+        xSemaphoreTake(stopped, portMAX_DELAY);
+        running = false;
+        release_queues();
+    }
+
+    void Pipeline::release_queues()
+    {
+        for (int i = 0; i < STAGE_COUNT; i++)
+        {
+            if (queues[i])
+            {
+                vQueueDelete(queues[i]);
+                queues[i] = nullptr;
+            }
+        }
+        if (free_jobs)
+        {
+            vQueueDelete(free_jobs);
+            free_jobs = nullptr;
+        }
+        if (stopped)
+        {
+            vSemaphoreDelete(stopped);
+            stopped = nullptr;
+        }
+        free(jobs);
+        jobs = nullptr;
+    }
+
+    void Pipeline::control(Control command)
+    {
+        if (controls == nullptr)
+        {
+            return;
+        }
+        switch (command)
+        {
+        case CONTROL_RUN:
+            xEventGroupClearBits(controls, kSingleShot);
+            xEventGroupSetBits(controls, kRun);
+            break;
+        case CONTROL_SINGLE_SHOT:
+            xEventGroupClearBits(controls, kRun);
+            xEventGroupSetBits(controls, kSingleShot);
+            break;
+        default:
+            xEventGroupClearBits(controls, kRun | kSingleShot);
+            break;
+        }
+    }
+
+    bool Pipeline::paused() const
+    {
+        return controls == nullptr || (xEventGroupGetBits(controls) & (kRun | kSingleShot)) == 0;
+    }
+
+    Stats Pipeline::stats() const
+    {
+        Stats copy = {};
+        if (stats_lock)
+        {
+            xSemaphoreTake(stats_lock, portMAX_DELAY);
+            copy = counters;
+            xSemaphoreGive(stats_lock);
+        }
+        return copy;
+    }
+
+    void Pipeline::reset_stats()
+    {
+        xSemaphoreTake(stats_lock, portMAX_DELAY);
+        counters = Stats();
+        xSemaphoreGive(stats_lock);
+    }
+
+    void Pipeline::print_stats() const
+    {
+        static const char *names[STAGE_COUNT] = {"preprocess", "invoke", "postprocess"};
+        Stats s = stats();
+
+        // one line, tools/show.py takes indented lines for results
+        printf("%s: %u frames, %u failed, %u dropped, %u skipped", config.name, (unsigned)s.frames,
+               (unsigned)s.failures, (unsigned)s.dropped, (unsigned)s.skipped);
+        for (int i = 0; i < STAGE_COUNT; i++)
+        {
+            printf(" | %s %.1f ms (max %.1f, queued %.1f)", names[i], s.run[i].mean() / 1000.0,
+                   s.run[i].max / 1000.0, s.wait[i].mean() / 1000.0);
+        }
+        printf(" | latency %.1f ms (max %.1f)\n", s.latency.mean() / 1000.0, s.latency.max / 1000.0);
+    }
+
+    void *Pipeline::acquire()
+    {
+        void *frame = source.acquire(pdMS_TO_TICKS(100));
+        if (frame == nullptr || config.policy != POLICY_LATEST_FRAME)
+        {
+            return frame;
+        }
+
+        // the frames behind this one are newer, only the last of them is worth the work
+        uint32_t dropped = 0;
+        for (uint32_t n = source.waiting(); n; n--)
+        {
+            void *newer = source.acquire(0);
+            if (newer == nullptr)
+            {
+                break;
+            }
+            source.release(frame);
+            frame = newer;
+            dropped++;
+        }
+        if (dropped)
+        {
+            xSemaphoreTake(stats_lock, portMAX_DELAY);
+            counters.dropped += dropped;
+            xSemaphoreGive(stats_lock);
+        }
+        return frame;
+    }
+
+    void Pipeline::finish(Job *job)
+    {
+        job->end[STAGE_POSTPROCESS] = now();
+        if (sink)
+        {
+            sink->consume(job->frame);
+        }
+        else
+        {
+            source.release(job->frame);
+        }
+        job->frame = nullptr;
+
+        xSemaphoreTake(stats_lock, portMAX_DELAY);
+        if (job->ok)
+        {
+            counters.frames++;
+            counters.skipped += job->skip;
+            for (int i = 0; i < STAGE_COUNT; i++)
+            {
+                counters.run[i].add(job->elapsed((Stage)i));
+                if (i > 0)
+                {
+                    counters.wait[i].add(job->start[i] - job->end[i - 1]);
+                }
+            }
+            counters.latency.add(job->end[STAGE_POSTPROCESS] - job->start[STAGE_PREPROCESS]);
+        }
+        else
+        {
+            counters.failures++;
+        }
+        bool report = config.stats_interval && counters.frames >= config.stats_interval;
+        xSemaphoreGive(stats_lock);
+
+        if (report)
+        {
+            print_stats();
+            reset_stats();
+        }
+        xQueueSend(free_jobs, &job, portMAX_DELAY);
+    }
+
+    void Pipeline::preprocess_task(void *arg)
+    {
+        Pipeline *self = (Pipeline *)arg;
+        Job *job = nullptr;
+        int64_t idle = now();
+
+        while (true)
+        {
+            // paused, the task sleeps here until control() or stop()
+            EventBits_t bits = xEventGroupWaitBits(self->controls, kRun | kSingleShot | kStop, pdFALSE, pdFALSE,
+                                                   portMAX_DELAY);
+            if (bits & kStop)
+            {
+                break;
+            }
+            if ((bits & (kRun | kSingleShot)) == 0)
+            {
+                continue;
+            }
+            // a free slot first, so the frame taken is the newest one once the slot is there
+            if (uxQueueMessagesWaiting(self->free_jobs) == 0)
+            {
+                idle = now();
+            }
+            if (xQueueReceive(self->free_jobs, &job, pdMS_TO_TICKS(100)) != pdTRUE)
+            {
+                continue;
+            }
+            job->frame = self->acquire();
+            if (job->frame == nullptr)
+            {
+                idle = now();
+                xQueueSend(self->free_jobs, &job, 0);
+                continue;
+            }
+            if ((bits & kRun) == 0)
+            {
+                // the shot has its frame
+                xEventGroupClearBits(self->controls, kSingleShot);
+            }
+            job->seq = self->seq++;
+            job->skip = false;
+            job->start[STAGE_PREPROCESS] = now();
+            job->ok = self->model.preprocess(*job);
+            job->end[STAGE_PREPROCESS] = now();
+            xQueueSend(self->queues[STAGE_INVOKE], &job, portMAX_DELAY);
+            keep_idle_alive(idle);
+        }
+
+        job = nullptr;
+        xQueueSend(self->queues[STAGE_INVOKE], &job, portMAX_DELAY);
+        vTaskDelete(NULL);
+    }
+
+    void Pipeline::invoke_task(void *arg)
+    {
+        Pipeline *self = (Pipeline *)arg;
+        Job *job = nullptr;
+        int64_t idle = now();
+
+        while (true)
+        {
+            receive(self->queues[STAGE_INVOKE], &job, idle);
+            if (job == nullptr)
+            {
+                break;
+            }
+            job->start[STAGE_INVOKE] = now();
+            if (job->ok && !job->skip)
+            {
+                job->ok = self->model.invoke(*job);
+            }
+            job->end[STAGE_INVOKE] = now();
+            xQueueSend(self->queues[STAGE_POSTPROCESS], &job, portMAX_DELAY);
+            keep_idle_alive(idle);
+        }
+
+        xQueueSend(self->queues[STAGE_POSTPROCESS], &job, portMAX_DELAY);
+        vTaskDelete(NULL);
+    }
+
+    void Pipeline::postprocess_task(void *arg)
+    {
+        Pipeline *self = (Pipeline *)arg;
+        Job *job = nullptr;
+        int64_t idle = now();
+
+        while (true)
+        {
+            receive(self->queues[STAGE_POSTPROCESS], &job, idle);
+            if (job == nullptr)
+            {
+                break;
+            }
+            job->start[STAGE_POSTPROCESS] = now();
+            if (job->ok)
+            {
+                self->model.postprocess(*job);
+            }
+            self->finish(job);
+            keep_idle_alive(idle);
+        }
+
+        xSemaphoreGive(self->stopped);
+        vTaskDelete(NULL);
+    }
+
+    void Pipeline::event_task(void *arg)
+    {
+        Pipeline *self = (Pipeline *)arg;
+
+        while (true)
+        {
+            // wide enough for bool, uint8_t and enum items alike
+            uint32_t command = 0;
+            if (xQueueReceive(self->event, &command, portMAX_DELAY))
+            {
+                self->control((Control)command);
+            }
+        }
+    }
+}
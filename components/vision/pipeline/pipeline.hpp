@@ -0,0 +1,256 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+
+/*
+ * Frames flow from a Source through three stage tasks, preprocess -> invoke ->
+ * postprocess, and on to a Sink (or back to the Source). Each stage has its
+ * own input queue, core and priority, so a model only supplies the work done
+ * in each stage. The pipeline itself never looks inside a frame and depends
+ * on FreeRTOS only, camera and LCD plug in as Source and Sink.
+ */
+namespace pipeline
+{
+    enum Stage
+    {
+        STAGE_PREPROCESS,
+        STAGE_INVOKE,
+        STAGE_POSTPROCESS,
+        STAGE_COUNT
+    };
+
+    /* what preprocess does when frames arrive faster than the pipeline takes them */
+    enum Policy
+    {
+        POLICY_EVERY_FRAME,  /* take frames in order, the source waits for the pipeline */
+        POLICY_LATEST_FRAME, /* take the newest frame waiting, give the older ones straight back */
+    };
+
+    /*
+     * What preprocess does with the next frame. The event queue of start()
+     * takes them as items of up to 4 bytes, so a queue of bool still pauses
+     * on false and runs on true.
+     */
+    enum Control
+    {
+        CONTROL_PAUSE = 0,       /* finish the frames in flight, take no more */
+        CONTROL_RUN = 1,         /* take every frame the policy lets through */
+        CONTROL_SINGLE_SHOT = 2, /* take one frame, then pause */
+    };
+
+    struct StageConfig
+    {
+        uint8_t depth;    /* jobs that can wait in front of the stage, preprocess reads the source directly */
+        int8_t core;      /* core the task is pinned to, -1 for any, 0 on single core chips */
+        uint8_t priority;
+        uint32_t stack;
+    };
+
+    struct Config
+    {
+        const char *name;                /* task names */
+        uint8_t slots;                   /* jobs in flight, clamped to Model::slots() */
+        Policy policy;
+        uint32_t stats_interval;         /* print and reset the stats every so many frames, 0 never */
+        StageConfig stages[STAGE_COUNT];
+    };
+
+    /* every stage on core 0 at priority 5, one job in flight, every frame */
+    Config default_config(const char *name, uint32_t stack = 4 * 1024);
+
+    /*
+     * two jobs in flight, invoke alone on core 0 and preprocess/postprocess on
+     * core 1: the next frame is converted while the model runs on this one, so
+     * a frame takes about the slowest stage instead of the sum of them
+     */
+    Config pipelined_config(const char *name, uint32_t stack = 4 * 1024);
+
+    /**
+     * @brief One frame on its way through the stages
+     *
+     * A job owns its frame from Source::acquire() until the frame is handed
+     * to the Sink or back to the Source after postprocess, and it owns the
+     * model buffers of its slot for as long as it is in flight: no two jobs
+     * in flight share a slot.
+     */
+    struct Job
+    {
+        void *frame;
+        uint8_t slot;                  /* model buffers of this job, < the pipeline's slots */
+        bool ok;                       /* false once a stage failed, the rest of the work is skipped */
+        bool skip;                     /* set by preprocess: nothing new to see, invoke is skipped */
+        uint32_t seq;                  /* frames acquired before this one */
+        int64_t start[STAGE_COUNT];    /* us */
+        int64_t end[STAGE_COUNT];
+
+        /* time spent in a stage, us */
+        int64_t elapsed(Stage stage) const { return end[stage] - start[stage]; }
+    };
+
+    /* a latency counter, us */
+    struct Latency
+    {
+        uint32_t count;
+        int64_t total;
+        int64_t max;
+
+        void add(int64_t us);
+        int64_t mean() const { return count ? total / count : 0; }
+    };
+
+    struct Stats
+    {
+        uint32_t frames;             /* through postprocess */
+        uint32_t failures;           /* failed a stage */
+        uint32_t dropped;            /* given back unprocessed under POLICY_LATEST_FRAME */
+        uint32_t skipped;            /* of frames, passed through without an invoke (Job::skip) */
+        Latency run[STAGE_COUNT];    /* in the stage */
+        Latency wait[STAGE_COUNT];   /* queued in front of the stage, from the end of the one before */
+        Latency latency;             /* acquired -> handed on */
+    };
+
+    class Source
+    {
+    public:
+        virtual ~Source() = default;
+
+        /* a frame, nullptr if none arrived within wait */
+        virtual void *acquire(TickType_t wait) = 0;
+
+        /* frames ready to be acquired without waiting, newer than the one just acquired */
+        virtual uint32_t waiting() const { return 0; }
+
+        /* take back a frame that is not passed on to a sink */
+        virtual void release(void *frame) = 0;
+    };
+
+    class Sink
+    {
+    public:
+        virtual ~Sink() = default;
+
+        /* take over a processed frame */
+        virtual void consume(void *frame) = 0;
+    };
+
+    class Model
+    {
+    public:
+        virtual ~Model() = default;
+
+        /* jobs the model can keep buffers for at the same time */
+        virtual uint8_t slots() const { return 1; }
+
+        /* frame -> model input of job.slot */
+        virtual bool preprocess(Job &job) = 0;
+
+        /* model input -> model output of job.slot */
+        virtual bool invoke(Job &job) = 0;
+
+        /* model output (and frame) -> results, the frame can still be drawn on */
+        virtual void postprocess(Job &job) = 0;
+    };
+
+    /* frames from a queue of pointers, like the one register_camera() fills */
+    class QueueSource : public Source
+    {
+    public:
+        /* release_frame: how frames go back to their owner, nullptr if they need not */
+        QueueSource(QueueHandle_t queue, void (*release_frame)(void *frame));
+
+        void *acquire(TickType_t wait) override;
+        uint32_t waiting() const override;
+        void release(void *frame) override;
+
+    private:
+        QueueHandle_t queue;
+        void (*release_frame)(void *frame);
+    };
+
+    /* frames into a queue of pointers, like the one register_lcd() reads */
+    class QueueSink : public Sink
+    {
+    public:
+        explicit QueueSink(QueueHandle_t queue);
+
+        void consume(void *frame) override;
+
+    private:
+        QueueHandle_t queue;
+    };
+
+    class Pipeline
+    {
+    public:
+        /* sink nullptr: frames go back to the source after postprocess */
+        Pipeline(Model &model, Source &source, Sink *sink = nullptr);
+        ~Pipeline();
+
+        /**
+         * @brief Create the queues and stage tasks
+         *
+         * @param config   stages and slots
+         * @param event    optional queue of Control, handed to control() as they come
+         * @param initial  CONTROL_PAUSE to start without taking frames
+         * @return 0 on success, -1 if already started or out of memory
+         */
+        int start(const Config &config, QueueHandle_t event = nullptr, Control initial = CONTROL_RUN);
+
+        /* drain the jobs in flight and end the stage tasks */
+        void stop();
+
+        /*
+         * Run, pause or take a single frame, from any task. A paused pipeline
+         * has every stage blocked and takes no CPU time. Single shots asked
+         * for before the previous one got its frame count as one.
+         */
+        void control(Control command);
+        bool paused() const;
+
+        /* frames through postprocess, and frames that failed a stage */
+        uint32_t frames() const { return stats().frames; }
+        uint32_t failures() const { return stats().failures; }
+
+        /* a consistent copy of the counters since start() or the last reset */
+        Stats stats() const;
+        void reset_stats();
+        void print_stats() const;
+
+    private:
+        static void preprocess_task(void *arg);
+        static void invoke_task(void *arg);
+        static void postprocess_task(void *arg);
+        static void event_task(void *arg);
+
+        void *acquire();
+        void finish(Job *job);
+        void release_queues();
+
+        Model &model;
+        Source &source;
+        Sink *sink;
+        Config config;
+
+        Job *jobs;
+        QueueHandle_t free_jobs;
+        QueueHandle_t queues[STAGE_COUNT];
+        QueueHandle_t event;
+        SemaphoreHandle_t stopped;
+        SemaphoreHandle_t stats_lock;
+        EventGroupHandle_t controls; /* CONTROL_* bits, plus stop for preprocess */
+        TaskHandle_t event_handle;
+
+        volatile bool running;
+        uint32_t seq;
+        Stats counters;
+    };
+
+    /* monotonic time in us */
+    int64_t now();
+}
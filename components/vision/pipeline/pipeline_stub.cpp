@@ -0,0 +1,122 @@
+#include <stdlib.h>
+
+#include "pipeline_stub.hpp"
+#include "isp.h"
+
+namespace pipeline
+{
+    StubCamera::StubCamera(int width, int height, uint8_t count, uint32_t interval)
+        : count(count), interval(interval), next(0), seq(0), returned(0)
+    {
+        frames = (StubFrame *)calloc(count, sizeof(StubFrame));
+        free_frames = xQueueCreate(count, sizeof(StubFrame *));
+        for (uint8_t i = 0; frames && free_frames && i < count; i++)
+        {
+            StubFrame *frame = &frames[i];
+            frame->width = width;
+            frame->height = height;
+            frame->format = ISP_FORMAT_RGB565;
+            frame->len = width * height * 2;
+            frame->buf = (uint8_t *)malloc(frame->len);
+            if (frame->buf == NULL)
+            {
+                continue;
+            }
+            // a gradient, so conversions have something to average
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    uint16_t v = (x * 31 / width) << 11 | (y * 63 / height) << 5 | ((x + y + i) & 31);
+                    frame->buf[(y * width + x) * 2] = v >> 8;
+                    frame->buf[(y * width + x) * 2 + 1] = v & 0xFF;
+                }
+            }
+            xQueueSend(free_frames, &frame, 0);
+        }
+    }
+
+    StubCamera::~StubCamera()
+    {
+        for (uint8_t i = 0; frames && i < count; i++)
+        {
+            free(frames[i].buf);
+        }
+        free(frames);
+        if (free_frames)
+        {
+            vQueueDelete(free_frames);
+        }
+    }
+
+    void *StubCamera::acquire(TickType_t wait)
+    {
+        StubFrame *frame = NULL;
+
+        if (free_frames == NULL || xQueueReceive(free_frames, &frame, wait) != pdTRUE)
+        {
+            return nullptr;
+        }
+        int64_t captured = now();
+        if (interval)
+        {
+            // frames come at the sensor's frame rate, next is when the one to hand out was captured
+            if (next == 0)
+            {
+                next = captured;
+            }
+            next = next > oldest() ? next : oldest();
+            if (next > captured)
+            {
+                vTaskDelay(pdMS_TO_TICKS((next - captured + 999) / 1000));
+            }
+            captured = next;
+            next += interval;
+        }
+        frame->seq = seq++;
+        frame->timestamp = captured;
+        return frame;
+    }
+
+    uint32_t StubCamera::waiting() const
+    {
+        // without an interval frames are captured on demand, none ever wait
+        int64_t t = now();
+        int64_t first = next > oldest() ? next : oldest();
+        if (interval == 0 || free_frames == NULL || next == 0 || t < first)
+        {
+            return 0;
+        }
+        uint32_t frames = (t - first) / interval + 1;
+        uint32_t buffers = uxQueueMessagesWaiting(free_frames);
+        return frames < buffers ? frames : buffers;
+    }
+
+    int64_t StubCamera::oldest() const
+    {
+        // the sensor keeps as many frames as it has buffers and overwrites the older ones
+        return now() - (int64_t)(count - 1) * interval;
+    }
+
+    void StubCamera::release(void *frame)
+    {
+        returned = returned + 1;
+        xQueueSend(free_frames, &frame, portMAX_DELAY);
+    }
+
+    StubLcd::StubLcd(Source &camera) : camera(camera), frames(0), out_of_order(0), last(-1)
+    {
+    }
+
+    void StubLcd::consume(void *frame)
+    {
+        StubFrame *f = (StubFrame *)frame;
+        if ((int64_t)f->seq <= last)
+        {
+            out_of_order++;
+        }
+        last = f->seq;
+        frames = frames + 1;
+        camera.release(frame);
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pipeline.hpp"
+
+/*
+ * Camera and LCD stand-ins, so a pipeline runs (and is benchmarked) without
+ * a board: the camera cycles through a few synthetic frames like the driver
+ * cycles its frame buffers, the LCD only counts what it is shown.
+ */
+namespace pipeline
+{
+    struct StubFrame
+    {
+        uint8_t *buf;
+        size_t len;
+        int width, height;
+        uint8_t format; /* ISP_FORMAT_* */
+        uint32_t seq;   /* frames captured before this one */
+        int64_t timestamp; /* captured, us */
+    };
+
+    class StubCamera : public Source
+    {
+    public:
+        /**
+         * @param width, height  RGB565 frame size
+         * @param count          frame buffers, acquire() blocks while all are out
+         * @param interval       us between two frames, 0 for as fast as they are taken
+         */
+        StubCamera(int width, int height, uint8_t count, uint32_t interval = 0);
+        ~StubCamera() override;
+
+        void *acquire(TickType_t wait) override;
+        uint32_t waiting() const override;
+        void release(void *frame) override;
+
+        uint32_t captured() const { return seq; }
+        uint32_t released() const { return returned; }
+
+    private:
+        /* capture time of the oldest frame the sensor still holds */
+        int64_t oldest() const;
+
+        StubFrame *frames;
+        uint8_t count;
+        QueueHandle_t free_frames;
+        uint32_t interval;
+        int64_t next;
+        uint32_t seq;
+        volatile uint32_t returned;
+    };
+
+    class StubLcd : public Sink
+    {
+    public:
+        /* frames are given back to the camera once shown, like register_lcd(..., true) */
+        explicit StubLcd(Source &camera);
+
+        void consume(void *frame) override;
+
+        uint32_t shown() const { return frames; }
+        /* frames shown out of capture order */
+        uint32_t reordered() const { return out_of_order; }
+
+    private:
+        Source &camera;
+        volatile uint32_t frames;
+        uint32_t out_of_order;
+        int64_t last;
+    };
+}
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""Baseline JPEG encoder for the jpeg test samples (no dependencies).
+
+usage: gen_jpeg_samples.py jpeg_samples.c [dir for the .jpg files]
+"""
+import math, sys
+
+ZIGZAG = [0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5, 12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21,
+          28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54,
+          47, 55, 62, 63]
+Q_LUMA = [16, 11, 10, 16, 24, 40, 51, 61, 12, 12, 14, 19, 26, 58, 60, 55, 14, 13, 16, 24, 40, 57, 69, 56, 14, 17, 22, 29,
+          51, 87, 80, 62, 18, 22, 37, 56, 68, 109, 103, 77, 24, 35, 55, 64, 81, 104, 113, 92, 49, 64, 78, 87, 103, 121, 120,
+          101, 72, 92, 95, 98, 112, 100, 103, 99]
+Q_CHROMA = [17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99, 24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99,
+            99, 99, 99, 99] + [99] * 32
+DC_LUMA = ([0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0], list(range(12)))
+DC_CHROMA = ([0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0], list(range(12)))
+AC_LUMA = ([0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d], bytes.fromhex(
+    "01020300041105122131410613516107227114328191a1082342b1c11552d1f02433627282090a161718191a25262728292a3435363738393a"
+    "434445464748494a535455565758595a636465666768696a737475767778797a838485868788898a92939495969798999aa2a3a4a5a6a7a8a9"
+    "aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9eaf1f2f3f4f5f6f7f8f9fa"))
+AC_CHROMA = ([0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77], bytes.fromhex(
+    "000102031104052131061241510761711322328108144291a1b1c109233352f0156272d10a162434e125f11718191a262728292a35363738"
+    "393a434445464748494a535455565758595a636465666768696a737475767778797a82838485868788898a92939495969798999aa2a3a4a5"
+    "a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae2e3e4e5e6e7e8e9eaf2f3f4f5f6f7f8f9fa"))
+
+
+def scale_q(q, quality):
+    s = 5000 // quality if quality < 50 else 200 - quality * 2
+    return [min(255, max(1, (v * s + 50) // 100)) for v in q]
+
+
+def huff_codes(bits, vals):
+    codes, code, k = {}, 0, 0
+    for length in range(1, 17):
+        for _ in range(bits[length - 1]):
+            codes[vals[k]] = (code, length)
+            code += 1
+            k += 1
+        code <<= 1
+    return codes
+
+
+class Bits:
+    def __init__(self):
+        self.out, self.acc, self.n = bytearray(), 0, 0
+
+    def put(self, code, length):
+        for i in range(length - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((code >> i) & 1)
+            self.n += 1
+            if self.n == 8:
+                self.out.append(self.acc)
+                if self.acc == 0xFF:
+                    self.out.append(0)
+                self.acc, self.n = 0, 0
+
+    def flush(self):
+        if self.n:
+            self.put((1 << (8 - self.n)) - 1, 8 - self.n)
+
+
+COS = [[math.cos((2 * x + 1) * u * math.pi / 16) for x in range(8)] for u in range(8)]
+
+
+def fdct(block):
+    out = [0.0] * 64
+    for v in range(8):
+        for u in range(8):
+            s = 0.0
+            for y in range(8):
+                for x in range(8):
+                    s += block[y * 8 + x] * COS[u][x] * COS[v][y]
+            cu = math.sqrt(0.5) if u == 0 else 1.0
+            cv = math.sqrt(0.5) if v == 0 else 1.0
+            out[v * 8 + u] = 0.25 * cu * cv * s
+    return out
+
+
+def magnitude(v):
+    n = abs(v).bit_length()
+    return n, (v if v >= 0 else v + (1 << n) - 1)
+
+
+def encode_block(bits, block, q, dc_codes, ac_codes, prev):
+    coef = fdct([p - 128 for p in block])
+    zz = [int(round(coef[ZIGZAG[k]] / q[ZIGZAG[k]])) for k in range(64)]
+    n, m = magnitude(zz[0] - prev)
+    bits.put(*dc_codes[n])
+    bits.put(m, n)
+    run = 0
+    for k in range(1, 64):
+        if zz[k] == 0:
+            run += 1
+            continue
+        while run > 15:
+            bits.put(*ac_codes[0xF0])
+            run -= 16
+        n, m = magnitude(zz[k])
+        bits.put(*ac_codes[(run << 4) | n])
+        bits.put(m, n)
+        run = 0
+    if run:
+        bits.put(*ac_codes[0x00])
+    return zz[0]
+
+
+def encode(rgb, w, h, gray=False, hs=1, vs=1, quality=90, restart=0):
+    ql, qc = scale_q(Q_LUMA, quality), scale_q(Q_CHROMA, quality)
+    px = lambda x, y: rgb[min(y, h - 1) * w + min(x, w - 1)]
+    planes = []
+    ys = lambda p: 0.299 * p[0] + 0.587 * p[1] + 0.114 * p[2]
+    cb = lambda p: -0.168736 * p[0] - 0.331264 * p[1] + 0.5 * p[2] + 128
+    cr = lambda p: 0.5 * p[0] - 0.418688 * p[1] - 0.081312 * p[2] + 128
+    comps = [(1, hs, vs, 0, ys)] if gray else [(1, hs, vs, 0, ys), (2, 1, 1, 1, cb), (3, 1, 1, 1, cr)]
+    if gray:
+        hs = vs = 1
+        comps = [(1, 1, 1, 0, ys)]
+    mw, mh = 8 * hs, 8 * vs
+    mcux, mcuy = (w + mw - 1) // mw, (h + mh - 1) // mh
+
+    out = bytearray(b"\xff\xd8")
+    seg = lambda marker, data: out.extend(bytes([0xFF, marker]) + (len(data) + 2).to_bytes(2, "big") + data)
+    seg(0xDB, bytes([0]) + bytes(ql[ZIGZAG[k]] for k in range(64)) + bytes([1]) + bytes(qc[ZIGZAG[k]] for k in range(64)))
+    sof = bytes([8]) + h.to_bytes(2, "big") + w.to_bytes(2, "big") + bytes([len(comps)])
+    for cid, ch, cv, tq, _ in comps:
+        sof += bytes([cid, (ch << 4) | cv, tq])
+    seg(0xC0, sof)
+    for cls, tid, (b, v) in [(0, 0, DC_LUMA), (1, 0, AC_LUMA), (0, 1, DC_CHROMA), (1, 1, AC_CHROMA)]:
+        seg(0xC4, bytes([(cls << 4) | tid]) + bytes(b) + bytes(v))
+    if restart:
+        seg(0xDD, restart.to_bytes(2, "big"))
+    sos = bytes([len(comps)])
+    for cid, _, _, tq, _ in comps:
+        sos += bytes([cid, (tq << 4) | tq])
+    seg(0xDA, sos + bytes([0, 63, 0]))
+
+    codes = [(huff_codes(*DC_LUMA), huff_codes(*AC_LUMA)), (huff_codes(*DC_CHROMA), huff_codes(*AC_CHROMA))]
+    bits = Bits()
+    prev = [0] * len(comps)
+    mcu = 0
+    for my in range(mcuy):
+        for mx in range(mcux):
+            if restart and mcu and mcu % restart == 0:
+                bits.flush()
+                out.extend(bits.out)
+                bits = Bits()
+                out.extend(bytes([0xFF, 0xD0 + (mcu // restart - 1) % 8]))
+                prev = [0] * len(comps)
+            for ci, (cid, ch, cv, tq, conv) in enumerate(comps):
+                sx, sy = hs // ch, vs // cv
+                for by in range(cv):
+                    for bx in range(ch):
+                        block = []
+                        for y in range(8):
+                            for x in range(8):
+                                s = 0.0
+                                for dy in range(sy):
+                                    for dx in range(sx):
+                                        X = mx * mw + (bx * 8 + x) * sx + dx
+                                        Y = my * mh + (by * 8 + y) * sy + dy
+                                        s += conv(px(X, Y))
+                                block.append(s / (sx * sy))
+                        q = ql if tq == 0 else qc
+                        prev[ci] = encode_block(bits, block, q, codes[tq][0], codes[tq][1], prev[ci])
+            mcu += 1
+    bits.flush()
+    out.extend(bits.out)
+    out.extend(b"\xff\xd9")
+    return bytes(out)
+
+
+def pattern(w, h):
+    """must match fill_rgb888_pattern() in test_jpeg.c"""
+    img = []
+    for y in range(h):
+        for x in range(w):
+            r, g, b = x * 255 // (w - 1), y * 255 // (h - 1), (x + y) * 255 // (w + h - 2)
+            if w // 4 <= x < w // 2 and h // 4 <= y < h // 2:
+                r, g, b = 255 - r, 255 - g, 40
+            img.append((r, g, b))
+    return img
+
+
+def c_array(name, data):
+    lines = ["const unsigned char %s[] = {" % name]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % v for v in data[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("const unsigned int %s_len = %d;" % (name, len(data)))
+    return "\n".join(lines)
+
+
+if __name__ == "__main__":
+    samples = [
+        ("jpeg_sample_420", 160, 120, dict(hs=2, vs=2)),
+        ("jpeg_sample_422", 160, 120, dict(hs=2, vs=1, restart=4)),
+        ("jpeg_sample_444", 160, 120, dict()),
+        ("jpeg_sample_gray", 160, 120, dict(gray=True)),
+        ("jpeg_sample_qvga", 320, 240, dict(hs=2, vs=1)),
+    ]
+    parts = []
+    for name, w, h, kw in samples:
+        data = encode(pattern(w, h), w, h, **kw)
+        if len(sys.argv) > 2:
+            open("%s/%s.jpg" % (sys.argv[2], name), "wb").write(data)
+        parts.append(c_array(name, data))
+    header = "/* generated by gen_jpeg_samples.py, do not edit */\n\n"
+    open(sys.argv[1], "w").write(header + "\n\n".join(parts) + "\n")
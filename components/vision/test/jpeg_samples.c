@@ -0,0 +1,1165 @@
+/* generated by gen_jpeg_samples.py, do not edit */
+
+const unsigned char jpeg_sample_420[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06,
+    0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11,
+    0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18,
+    0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05,
+    0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x78, 0x00,
+    0xa0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00,
+    0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5,
+    0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01,
+    0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61,
+    0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1,
+    0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05,
+    0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42,
+    0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24,
+    0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8,
+    0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03,
+    0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc, 0xbb, 0x8a, 0xcf, 0xda, 0xae, 0x45,
+    0x67, 0xd3, 0x8a, 0xd1, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xd3, 0x8a, 0x51, 0x91, 0x95, 0x0c,
+    0x49, 0x9f, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xb4, 0x62, 0xb3, 0xf6, 0xab, 0x91, 0x59,
+    0xfb, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x26, 0x74, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a,
+    0xd1, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xed, 0x5d, 0x11, 0x91, 0xef, 0xd0, 0xc4, 0x99, 0xd0,
+    0xd9, 0xfb, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x5a, 0x30, 0xd9, 0xfb, 0x55, 0xc8, 0xac, 0xfa, 0x71,
+    0x5d, 0x11, 0x91, 0xef, 0xd0, 0xc4, 0x99, 0xd1, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfd, 0xab, 0x42,
+    0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x74, 0x46, 0x47, 0xbf, 0x43, 0x12, 0x67, 0x45, 0x67,
+    0xed, 0x57, 0x62, 0xb3, 0xf6, 0xad, 0x08, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0xd1, 0x19,
+    0x1e, 0xfd, 0x0c, 0x49, 0x9d, 0x15, 0x9f, 0x4e, 0x2a, 0xec, 0x56, 0x7d, 0x38, 0xad, 0x08, 0xac,
+    0xfa, 0x71, 0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x74, 0x46, 0x47, 0xbf, 0x43, 0x12, 0x67, 0x45, 0x67,
+    0xed, 0x57, 0x62, 0xb3, 0xf6, 0xad, 0x08, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0xd1, 0x19,
+    0x1e, 0xfd, 0x0c, 0x49, 0x9d, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xb4, 0x22, 0xb3, 0xf6,
+    0xab, 0xb1, 0x59, 0xfb, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x26, 0x74, 0x56, 0x7d, 0x38, 0xab,
+    0x91, 0x59, 0xfb, 0x56, 0x8c, 0x56, 0x7d, 0x38, 0xab, 0xb0, 0xd9, 0xfb, 0x57, 0x44, 0x64, 0x7b,
+    0xf4, 0x31, 0x27, 0xc5, 0xf1, 0x59, 0x7b, 0x55, 0xc8, 0xac, 0xba, 0x71, 0x5a, 0x31, 0x59, 0x7b,
+    0x55, 0xc8, 0xac, 0xba, 0x71, 0x5f, 0x96, 0x46, 0x47, 0xf9, 0x7f, 0x43, 0x12, 0x67, 0xc5, 0x65,
+    0xed, 0x57, 0x22, 0xb2, 0xf6, 0xad, 0x18, 0xac, 0xbd, 0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0xd1, 0x19,
+    0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15, 0x97, 0xb5, 0x5c, 0x8a, 0xcb, 0xda, 0xb4, 0x62, 0xb2, 0xf6,
+    0xaf, 0x52, 0x4f, 0xd9, 0xb3, 0xe2, 0x02, 0x75, 0xf0, 0xf8, 0x1f, 0xf6, 0xfb, 0x6f, 0xff, 0x00,
+    0xc7, 0x2b, 0x3a, 0xf8, 0xfc, 0x2e, 0x0e, 0xdf, 0x59, 0xab, 0x18, 0x5f, 0x6e, 0x66, 0x95, 0xed,
+    0xbd, 0xae, 0xcf, 0xa0, 0xa1, 0x5d, 0xbd, 0x8f, 0x29, 0x8a, 0xcb, 0xda, 0xae, 0x45, 0x65, 0xd3,
+    0x8a, 0xf5, 0x14, 0xfd, 0x9d, 0xfc, 0x76, 0x9f, 0x7b, 0x42, 0x03, 0xfe, 0xdf, 0x2d, 0xff, 0x00,
+    0xf8, 0xe5, 0x4e, 0x9f, 0x00, 0xbc, 0x6c, 0x9f, 0x7b, 0x45, 0x03, 0xfe, 0xde, 0xe0, 0xff, 0x00,
+    0xe2, 0xeb, 0x28, 0xe7, 0x99, 0x67, 0xfd, 0x05, 0x53, 0xff, 0x00, 0xc0, 0xe3, 0xfe, 0x67, 0xb5,
+    0x4b, 0x19, 0x08, 0xfc, 0x52, 0x48, 0xf3, 0x38, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0xe8,
+    0xc9, 0xf0, 0x33, 0xc6, 0x29, 0xd7, 0x47, 0x03, 0xfe, 0xde, 0xa1, 0xff, 0x00, 0xe2, 0xea, 0x64,
+    0xf8, 0x2f, 0xe2, 0xb4, 0xeb, 0xa5, 0x01, 0xff, 0x00, 0x6f, 0x30, 0xff, 0x00, 0xf1, 0x75, 0xd3,
+    0x1c, 0xef, 0x2c, 0xff, 0x00, 0xa0, 0xaa, 0x7f, 0xf8, 0x1c, 0x7f, 0xcc, 0xf5, 0xe9, 0x66, 0xb8,
+    0x68, 0xfc, 0x55, 0x62, 0xbe, 0x68, 0xf3, 0xf8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0xa1,
+    0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xda, 0xbe, 0x82, 0x32, 0x3e, 0xae, 0x86, 0x24, 0xce, 0x8a,
+    0xcb, 0xa7, 0x15, 0x76, 0x2b, 0x2e, 0x9c, 0x56, 0x84, 0x56, 0x5d, 0x38, 0xab, 0xb1, 0x59, 0x74,
+    0xe2, 0xba, 0x23, 0x23, 0xdf, 0xa1, 0x89, 0x33, 0xa2, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b, 0x56,
+    0x84, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xe8, 0x8c, 0x8f, 0x7e, 0x86, 0x24, 0xce, 0x8a,
+    0xcb, 0xda, 0xae, 0xc5, 0x65, 0xed, 0x5a, 0x11, 0x59, 0x7b, 0x55, 0xd8, 0xac, 0xbd, 0xab, 0xa2,
+    0x32, 0x3d, 0xfa, 0x18, 0x93, 0x3a, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0x6c, 0xbd, 0xab, 0x42, 0x2b,
+    0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xbd, 0xab, 0xa2, 0x32, 0x3d, 0xfa, 0x18, 0x93, 0xe2, 0xf8, 0xac,
+    0xbd, 0xaa, 0xe4, 0x56, 0x5d, 0x38, 0xad, 0x18, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7d, 0x38, 0xaf,
+    0xcb, 0x23, 0x23, 0xfc, 0xbe, 0xa1, 0x89, 0x33, 0xe2, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x56,
+    0x8c, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3f, 0x6a, 0xe8, 0x8c, 0x8f, 0x7e, 0x86, 0x24, 0xcf, 0x8a,
+    0xcb, 0xda, 0xbf, 0x40, 0xa4, 0xbc, 0xf7, 0xaf, 0x86, 0xa2, 0xb3, 0xf6, 0xaf, 0xb2, 0xa4, 0xbb,
+    0xf7, 0xaf, 0xcb, 0xf8, 0xea, 0x3e, 0xd3, 0xea, 0xbf, 0xf6, 0xff, 0x00, 0xfe, 0xda, 0x7e, 0x81,
+    0x91, 0xff, 0x00, 0xb4, 0x42, 0xa7, 0x95, 0xbf, 0x53, 0x42, 0x5b, 0xcf, 0x7a, 0xab, 0x25, 0xe7,
+    0xbd, 0x67, 0xcb, 0x77, 0xef, 0x55, 0x24, 0xbb, 0xf7, 0xaf, 0xcc, 0xa3, 0x44, 0xf4, 0x2b, 0xe1,
+    0xcd, 0x19, 0x2f, 0x3d, 0xea, 0xac, 0x97, 0x9e, 0xf5, 0x9d, 0x25, 0xdf, 0xbd, 0x55, 0x92, 0xef,
+    0xde, 0xba, 0xe3, 0x44, 0xf9, 0xca, 0xf8, 0x73, 0xc2, 0xe2, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b,
+    0x56, 0x84, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xfe, 0xb2, 0x8c, 0x8f, 0xd3, 0xe8, 0x62,
+    0x4c, 0xe8, 0xac, 0xba, 0x71, 0x57, 0x62, 0xb2, 0xe9, 0xc5, 0x68, 0x45, 0x67, 0xd3, 0x8a, 0xbb,
+    0x15, 0x9f, 0x4e, 0x2b, 0xa2, 0x32, 0x3d, 0xfa, 0x18, 0x93, 0x3a, 0x2b, 0x2f, 0x6a, 0xbb, 0x15,
+    0x97, 0xb5, 0x68, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xae, 0x88, 0xc8, 0xf7, 0xe8, 0x62,
+    0x4c, 0xe8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0xa1, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf,
+    0xda, 0xba, 0x23, 0x23, 0xdf, 0xa1, 0x89, 0x33, 0xa2, 0xb2, 0xe9, 0xc5, 0x5d, 0x86, 0xcb, 0xda,
+    0xb4, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x86, 0xcf, 0xda, 0xba, 0x63, 0x23, 0xdf, 0xa1, 0x89, 0x3e,
+    0x2f, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xd3, 0x8a, 0xd1, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67,
+    0xd3, 0x8a, 0xfc, 0xae, 0x32, 0x3f, 0xcb, 0xfa, 0x18, 0x93, 0x3a, 0x2b, 0x3f, 0x6a, 0xb9, 0x15,
+    0x9f, 0xb5, 0x68, 0xc5, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xae, 0x98, 0xc8, 0xf7, 0xe8, 0x62,
+    0x4c, 0xe8, 0xac, 0xfd, 0xab, 0xe9, 0x29, 0x2e, 0xfd, 0xeb, 0xc2, 0xa2, 0xb3, 0xf6, 0xae, 0xeb,
+    0xfe, 0x13, 0x49, 0x24, 0xff, 0x00, 0x97, 0x2c, 0x7f, 0xdb, 0x5f, 0xfe, 0xc6, 0xbe, 0x4b, 0x88,
+    0xb2, 0xec, 0x46, 0x63, 0xec, 0x7d, 0x84, 0x6f, 0xcb, 0xcd, 0x7d, 0x52, 0xde, 0xdd, 0xda, 0xec,
+    0x7e, 0xa5, 0xc2, 0xf9, 0xb6, 0x0f, 0x09, 0x1a, 0xcb, 0x17, 0x3e, 0x5e, 0x6e, 0x5b, 0x68, 0xdd,
+    0xed, 0xcd, 0x7d, 0x93, 0xee, 0x8e, 0xc6, 0x5b, 0xbf, 0x7a, 0xab, 0x25, 0xdf, 0xbd, 0x73, 0x23,
+    0xc4, 0xb2, 0x4b, 0xff, 0x00, 0x2e, 0xd8, 0xff, 0x00, 0x81, 0xff, 0x00, 0xf5, 0xa9, 0x7f, 0xb5,
+    0x64, 0x93, 0xfe, 0x59, 0x63, 0xfe, 0x05, 0xff, 0x00, 0xd6, 0xaf, 0x94, 0x8f, 0x0e, 0x66, 0x1f,
+    0xf3, 0xeb, 0xf1, 0x8f, 0xf9, 0x9f, 0x5b, 0x53, 0x36, 0xcb, 0x6a, 0xfc, 0x15, 0x7f, 0x09, 0x7f,
+    0x91, 0xb5, 0x25, 0xdf, 0xbd, 0x55, 0x92, 0xef, 0xde, 0xa8, 0x79, 0xd2, 0x49, 0xfc, 0x38, 0xfc,
+    0x69, 0x45, 0xac, 0x92, 0x7f, 0x16, 0x3f, 0x0a, 0xeb, 0x8f, 0x0e, 0xe6, 0x1f, 0xf3, 0xef, 0xf1,
+    0x8f, 0xf9, 0x9e, 0x6d, 0x4a, 0xf8, 0x6a, 0x9f, 0x04, 0xbf, 0x06, 0x67, 0x45, 0x67, 0xed, 0x57,
+    0x62, 0xb3, 0xf6, 0xad, 0x18, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e, 0xd5, 0xfb, 0x6c, 0x64, 0x77,
+    0xd0, 0xc4, 0x99, 0xd1, 0x59, 0xf4, 0xe2, 0xae, 0xc5, 0x67, 0xd3, 0x8a, 0xd1, 0x8a, 0xcf, 0xa7,
+    0x15, 0x72, 0x2b, 0x3e, 0x9c, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x26, 0x74, 0x56, 0x7e, 0xd5,
+    0x76, 0x2b, 0x3f, 0x6a, 0xd1, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xed, 0x5d, 0x11, 0x91, 0xef,
+    0xd0, 0xc4, 0x99, 0xd1, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfd, 0xab, 0x46, 0x2b, 0x3f, 0x6a, 0xb9,
+    0x15, 0x9f, 0xb5, 0x74, 0x46, 0x47, 0xbf, 0x43, 0x12, 0x67, 0x45, 0x67, 0xd3, 0x8a, 0xbb, 0x15,
+    0x9f, 0xb5, 0x68, 0x45, 0x67, 0xd3, 0x8a, 0xbb, 0x0d, 0x9f, 0xb5, 0x74, 0x46, 0x47, 0xbf, 0x43,
+    0x12, 0x7c, 0x5f, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0xa1, 0x15, 0x97, 0xb5, 0x5d,
+    0x8a, 0xcb, 0xa7, 0x15, 0xf9, 0x64, 0x64, 0x7f, 0x97, 0xd4, 0x31, 0x26, 0x74, 0x56, 0x7e, 0xd5,
+    0x76, 0x2b, 0x3f, 0x6a, 0xd0, 0x8a, 0xcb, 0xda, 0xae, 0xc5, 0x65, 0xed, 0x5d, 0x11, 0x91, 0xef,
+    0xd0, 0xc4, 0x99, 0xd1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xab, 0x46, 0x2b, 0x2f, 0x6a, 0xbb,
+    0x15, 0x97, 0xb5, 0x74, 0x46, 0x47, 0xbf, 0x43, 0x12, 0x67, 0x45, 0x67, 0xed, 0x57, 0x22, 0xb3,
+    0xe9, 0xc5, 0x68, 0xc3, 0x65, 0xed, 0x57, 0x22, 0xb2, 0xe9, 0xc5, 0x74, 0x46, 0x47, 0xbf, 0x43,
+    0x12, 0x67, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xf6, 0xad, 0x18, 0xac, 0xbd, 0xaa, 0xe4, 0x56,
+    0x5e, 0xd5, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda,
+    0xb4, 0x62, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x26, 0x7c,
+    0x56, 0x7d, 0x38, 0xab, 0x91, 0x59, 0xf4, 0xe2, 0xb4, 0x62, 0xb2, 0xe9, 0xc5, 0x5c, 0x8a, 0xcb,
+    0xa7, 0x15, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda,
+    0xb4, 0x62, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x26, 0x7c,
+    0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3f, 0x6a, 0xd1, 0x8a, 0xcb, 0xda, 0xae, 0x45, 0x65, 0xed, 0x5d,
+    0x11, 0x91, 0xef, 0xd0, 0xc4, 0x99, 0xd1, 0x59, 0xf4, 0xe2, 0xae, 0xc3, 0x67, 0xed, 0x5a, 0x11,
+    0x59, 0x74, 0xe2, 0xae, 0xc5, 0x65, 0xed, 0x5d, 0x11, 0x91, 0xef, 0xd0, 0xc4, 0x9f, 0x17, 0xc5,
+    0x65, 0xed, 0x57, 0x62, 0xb2, 0xe9, 0xc5, 0x68, 0x45, 0x65, 0xed, 0x57, 0x62, 0xb2, 0xe9, 0xc5,
+    0x7e, 0x59, 0x19, 0x1f, 0xe5, 0xfd, 0x0c, 0x49, 0x9d, 0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xda,
+    0xb4, 0x22, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x26, 0x74,
+    0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xd0, 0x8a, 0xcb, 0xda, 0xae, 0xc5, 0x65, 0xed, 0x5d,
+    0x11, 0x91, 0xef, 0xd0, 0xc4, 0x99, 0xd0, 0xd9, 0x7b, 0x55, 0xd8, 0xac, 0xba, 0x71, 0x5a, 0x10,
+    0xd9, 0x7b, 0x55, 0xd8, 0xac, 0xba, 0x71, 0x5d, 0x11, 0x91, 0xef, 0xd0, 0xc4, 0x99, 0xd1, 0x59,
+    0x7b, 0x55, 0xc8, 0xac, 0xbd, 0xab, 0x46, 0x2b, 0x2f, 0x6a, 0xbb, 0x15, 0x97, 0xb5, 0x74, 0x46,
+    0x47, 0xbf, 0x43, 0x12, 0x67, 0x45, 0x65, 0xed, 0x57, 0x22, 0xb2, 0xf6, 0xad, 0x18, 0xac, 0xbd,
+    0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15, 0x97, 0x4e, 0x2a,
+    0xe4, 0x56, 0x5d, 0x38, 0xad, 0x18, 0xac, 0xba, 0x71, 0x57, 0x22, 0xb2, 0xe9, 0xc5, 0x74, 0x46,
+    0x47, 0xbf, 0x43, 0x12, 0x67, 0xc5, 0x65, 0xed, 0x57, 0x22, 0xb2, 0xf6, 0xad, 0x18, 0xac, 0xbd,
+    0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15, 0x97, 0xb5, 0x5c,
+    0x8a, 0xcb, 0xda, 0xb4, 0x62, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x57, 0x44, 0x64, 0x7b, 0xf4,
+    0x31, 0x26, 0x74, 0x56, 0x5d, 0x38, 0xab, 0xb0, 0xd9, 0x7b, 0x56, 0x8c, 0x56, 0x5d, 0x38, 0xab,
+    0x90, 0xd9, 0x7b, 0x57, 0x44, 0x64, 0x7b, 0xf4, 0x31, 0x27, 0xc5, 0xf1, 0x59, 0xfb, 0x55, 0xd8,
+    0xac, 0xfa, 0x71, 0x5a, 0x11, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x5f, 0x96, 0x46, 0x47,
+    0xf9, 0x7d, 0x43, 0x12, 0x67, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xad, 0x08, 0xac, 0xfd,
+    0xaa, 0xec, 0x56, 0x7e, 0xd5, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9d, 0x15, 0x9f, 0xb5, 0x5d,
+    0x8a, 0xcf, 0xda, 0xb4, 0x22, 0xb3, 0xf6, 0xab, 0xb1, 0x59, 0xfb, 0x57, 0x4c, 0x64, 0x7b, 0xf4,
+    0x31, 0x26, 0x74, 0x36, 0x7e, 0xd5, 0x76, 0x2b, 0x3e, 0x9c, 0x56, 0x84, 0x56, 0x7e, 0xd5, 0x76,
+    0x2b, 0x3e, 0x9c, 0x56, 0xf1, 0x91, 0xef, 0xd0, 0xc4, 0x99, 0xd1, 0x59, 0xfb, 0x55, 0xd8, 0xac,
+    0xfd, 0xab, 0x42, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x74, 0xc6, 0x47, 0xbf, 0x43, 0x12,
+    0x67, 0x45, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xf6, 0xad, 0x18, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e,
+    0xd5, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15, 0x9f, 0x4e, 0x2a, 0xe4, 0x56, 0x7d, 0x38,
+    0xad, 0x18, 0xac, 0xfa, 0x71, 0x57, 0x22, 0xb3, 0xe9, 0xc5, 0x74, 0x46, 0x47, 0xd0, 0x50, 0xc4,
+    0x99, 0xf1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xab, 0x46, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f,
+    0xb5, 0x74, 0x46, 0x47, 0xbf, 0x43, 0x12, 0x67, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xf6, 0xad,
+    0x18, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e, 0xd5, 0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0x9f, 0x15,
+    0x9f, 0x4e, 0x2a, 0xe4, 0x56, 0x7e, 0xd5, 0xa3, 0x15, 0x9f, 0x4e, 0x2a, 0xe4, 0x36, 0x7e, 0xd5,
+    0xd1, 0x19, 0x1e, 0xfd, 0x0c, 0x49, 0xf1, 0x84, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3e, 0x9c, 0x52,
+    0xc5, 0x57, 0x22, 0xed, 0x5f, 0x96, 0xc5, 0x9f, 0xe6, 0x1d, 0x0a, 0x92, 0x12, 0x2b, 0x3f, 0x6a,
+    0xbb, 0x15, 0x9f, 0xb5, 0x2c, 0x55, 0x72, 0x2a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x24, 0x24, 0x56,
+    0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0x58, 0xaa, 0xe4, 0x55, 0xd1, 0x16, 0x7b, 0xf4, 0x2a, 0x48,
+    0x48, 0x6c, 0xfd, 0xaa, 0xec, 0x56, 0x7d, 0x38, 0xa5, 0x8a, 0xae, 0x45, 0xda, 0xba, 0x22, 0xcf,
+    0xa0, 0xa1, 0x52, 0x42, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xa5, 0x8a, 0xae, 0x45, 0x5d,
+    0x11, 0x67, 0xbf, 0x42, 0xa4, 0x84, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed, 0x4b, 0x15, 0x5c,
+    0x8a, 0xba, 0x22, 0xcf, 0x7a, 0x85, 0x49, 0x09, 0x15, 0x9f, 0x4e, 0x2a, 0xec, 0x56, 0x7d, 0x38,
+    0xa2, 0x2e, 0xd5, 0x76, 0x2e, 0xd5, 0xd1, 0x16, 0x7d, 0x05, 0x0a, 0x92, 0x12, 0x2b, 0x3f, 0x6a,
+    0xbb, 0x15, 0x9f, 0xb5, 0x11, 0x55, 0xd8, 0xab, 0xa2, 0x2c, 0xf7, 0xe8, 0x54, 0x90, 0x91, 0x59,
+    0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xa9, 0x62, 0xab, 0xb1, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xa9, 0x21,
+    0x22, 0xb3, 0xe9, 0xc5, 0x5c, 0x86, 0xcf, 0xda, 0x96, 0x2e, 0xd5, 0x76, 0x1a, 0xe8, 0x8b, 0x3d,
+    0xfa, 0x15, 0x24, 0x7f, 0xff, 0xd9,
+};
+const unsigned int jpeg_sample_420_len = 2678;
+
+const unsigned char jpeg_sample_422[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06,
+    0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11,
+    0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18,
+    0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05,
+    0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x78, 0x00,
+    0xa0, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00,
+    0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5,
+    0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01,
+    0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61,
+    0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1,
+    0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05,
+    0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42,
+    0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24,
+    0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8,
+    0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00,
+    0x04, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xbb, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xd3, 0x8a, 0x71, 0x66, 0xb4, 0x2a, 0x17, 0x62, 0xb3,
+    0xf6, 0xab, 0x91, 0x59, 0xfb, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xa8, 0x5c, 0x8a, 0xcf, 0xda, 0xae,
+    0xc5, 0x67, 0xed, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa1, 0x72, 0x1b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f,
+    0x4e, 0x2b, 0xa2, 0x2c, 0xfa, 0x0a, 0x15, 0x0f, 0xff, 0xd0, 0xf8, 0x7a, 0x2b, 0x3f, 0x6a, 0xbb,
+    0x15, 0x9f, 0xb5, 0x7d, 0x0c, 0x59, 0xfd, 0x03, 0x42, 0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15,
+    0x9f, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x85, 0xc8, 0xac, 0xfa, 0x71, 0x57, 0x62, 0xb3, 0xe9,
+    0xc5, 0x74, 0x45, 0x9f, 0x41, 0x42, 0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x74,
+    0x45, 0x9e, 0xfd, 0x0a, 0x87, 0xff, 0xd1, 0xf0, 0x28, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5,
+    0xfa, 0x0c, 0x59, 0xfd, 0xfd, 0x42, 0xa1, 0x72, 0x2b, 0x3e, 0x9c, 0x55, 0xc8, 0xac, 0xfd, 0xab,
+    0xa6, 0x2c, 0xf7, 0xe8, 0x54, 0x3e, 0x30, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xd3, 0x8a, 0xfc,
+    0xc6, 0x2c, 0xff, 0x00, 0x34, 0xe8, 0x54, 0x2e, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xf6, 0xae,
+    0x88, 0xb3, 0xdf, 0xa1, 0x50, 0xff, 0xd2, 0xf8, 0x2a, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5,
+    0x76, 0x45, 0x9f, 0x5f, 0x42, 0xa1, 0x76, 0x1b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0x4e, 0x2b, 0xa2,
+    0x2c, 0xf7, 0xe8, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xae, 0x88, 0xb3, 0xdf,
+    0xa1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x43,
+    0xff, 0xd3, 0xf9, 0xb6, 0x2b, 0x3e, 0x9c, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x5f, 0x59, 0x16, 0x7f,
+    0x55, 0xd0, 0xa8, 0x5c, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed, 0x5d, 0x11, 0x67, 0xbf, 0x42,
+    0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x85, 0xc8,
+    0xac, 0xfa, 0x71, 0x57, 0x61, 0xb3, 0xf6, 0xae, 0x88, 0xb3, 0xdf, 0xa1, 0x50, 0xff, 0xd4, 0xfc,
+    0xf5, 0x8a, 0xcb, 0xda, 0xae, 0x45, 0x65, 0xd3, 0x8a, 0xe6, 0x8b, 0x3e, 0x6e, 0x85, 0x52, 0xec,
+    0x56, 0x5e, 0xd5, 0x72, 0x2b, 0x2f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0b, 0xb1, 0x59, 0x7b,
+    0x55, 0xc8, 0xac, 0xbd, 0xab, 0xa2, 0x2c, 0xf7, 0xe8, 0x55, 0x2e, 0xc5, 0x65, 0xed, 0x57, 0x22,
+    0xb2, 0xe9, 0xc5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0xa7, 0xff, 0xd5, 0xf9, 0x62, 0x2b, 0x2f, 0x6a,
+    0xbb, 0x15, 0x97, 0xb5, 0x7a, 0xf1, 0x67, 0xeb, 0x14, 0x2a, 0x17, 0x22, 0xb2, 0xf6, 0xab, 0xb1,
+    0x59, 0x7b, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xaa, 0x5c, 0x8a, 0xcb, 0xa7, 0x15, 0x76, 0x2b, 0x2e,
+    0x9c, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xaa, 0x5c, 0x8a, 0xcb, 0xda, 0xae, 0xc5, 0x65, 0xed, 0x5d,
+    0x11, 0x67, 0xbf, 0x42, 0xa1, 0xff, 0xd6, 0xf3, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5,
+    0xf6, 0xf1, 0x67, 0xf6, 0xa5, 0x0a, 0xa5, 0xc8, 0xac, 0xba, 0x71, 0x57, 0x61, 0xb2, 0xf6, 0xae,
+    0x88, 0xb3, 0xdf, 0xa1, 0x54, 0xf8, 0xbe, 0x2b, 0x2f, 0x6a, 0xb9, 0x15, 0x97, 0x4e, 0x2b, 0xf3,
+    0x18, 0xb3, 0xfc, 0xd3, 0xa1, 0x54, 0xbb, 0x15, 0x97, 0xb5, 0x5c, 0x8a, 0xcb, 0xda, 0xba, 0x22,
+    0xcf, 0x7e, 0x85, 0x53, 0xff, 0xd7, 0xf9, 0x12, 0x2b, 0x2f, 0x6a, 0xf5, 0x24, 0xfd, 0x9b, 0x3e,
+    0x20, 0x27, 0x5f, 0x0f, 0x81, 0xff, 0x00, 0x6f, 0xb6, 0xff, 0x00, 0xfc, 0x72, 0xbc, 0x7c, 0x7e,
+    0x73, 0x81, 0xca, 0x79, 0x3e, 0xb9, 0x53, 0x97, 0x9a, 0xf6, 0xd1, 0xbb, 0xda, 0xd7, 0xd9, 0x3e,
+    0xe8, 0xe8, 0xc3, 0xca, 0x52, 0x57, 0x5d, 0x09, 0xd3, 0xf6, 0x77, 0xf1, 0xda, 0x7d, 0xed, 0x08,
+    0x0f, 0xfb, 0x7c, 0xb7, 0xff, 0x00, 0xe3, 0x95, 0x3a, 0x7c, 0x02, 0xf1, 0xb2, 0x7d, 0xed, 0x14,
+    0x0f, 0xfb, 0x7b, 0x83, 0xff, 0x00, 0x8b, 0xaf, 0x3e, 0x3c, 0x61, 0x92, 0x7f, 0xcf, 0xff, 0x00,
+    0xfc, 0x96, 0x7f, 0xfc, 0x89, 0xeb, 0x43, 0x17, 0x4e, 0x97, 0xc6, 0xc9, 0xd3, 0xe0, 0x67, 0x8c,
+    0x53, 0xae, 0x8e, 0x07, 0xfd, 0xbd, 0x43, 0xff, 0x00, 0xc5, 0xd4, 0xc9, 0xf0, 0x5f, 0xc5, 0x69,
+    0xd7, 0x4a, 0x03, 0xfe, 0xde, 0x61, 0xff, 0x00, 0xe2, 0xeb, 0xa6, 0x3c, 0x61, 0x92, 0x7f, 0xcf,
+    0xff, 0x00, 0xfc, 0x96, 0x7f, 0xfc, 0x89, 0xdd, 0x0c, 0xef, 0x05, 0x4f, 0xe3, 0x9f, 0xe0, 0xff,
+    0x00, 0xc8, 0xe7, 0x22, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b, 0x57, 0xdc, 0x45, 0x9f, 0x6d, 0x42,
+    0xa9, 0xff, 0xd0, 0xf2, 0x78, 0xac, 0xba, 0x71, 0x57, 0x62, 0xb2, 0xe9, 0xc5, 0x7d, 0x0c, 0x59,
+    0xfd, 0x03, 0x42, 0xa9, 0x72, 0x2b, 0x2f, 0x6a, 0xbb, 0x15, 0x97, 0xb5, 0x74, 0x45, 0x9e, 0xfd,
+    0x0a, 0xa5, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0xd1, 0x16, 0x7b, 0xf4, 0x2a, 0x97,
+    0x22, 0xb2, 0xe9, 0xc5, 0x5d, 0x8a, 0xcb, 0xda, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x53, 0xff, 0xd1,
+    0xf8, 0xbe, 0x2b, 0x2f, 0x6a, 0xb9, 0x15, 0x97, 0x4e, 0x2b, 0xcb, 0x8b, 0x3f, 0x32, 0xa1, 0x50,
+    0xbb, 0x15, 0x97, 0xb5, 0x5c, 0x8a, 0xcb, 0xda, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x52, 0xec, 0x56,
+    0x5e, 0xd5, 0xfa, 0x05, 0x25, 0xe7, 0xbd, 0x7e, 0x55, 0xc7, 0xcb, 0x9b, 0xea, 0xbf, 0xf6, 0xff,
+    0x00, 0xfe, 0xd8, 0x7d, 0xb6, 0x55, 0xfb, 0xc8, 0x4f, 0xe5, 0xfa, 0x95, 0x25, 0xbc, 0xf7, 0xaa,
+    0xb2, 0x5e, 0x7b, 0xd7, 0xe5, 0x91, 0x81, 0xad, 0x7a, 0x67, 0xff, 0xd2, 0xf4, 0x59, 0x2f, 0x3d,
+    0xea, 0xac, 0x97, 0x9e, 0xf5, 0xfc, 0xaf, 0x18, 0x1e, 0x55, 0x7a, 0x67, 0xce, 0x11, 0x59, 0x7b,
+    0x55, 0xd8, 0xac, 0xbd, 0xab, 0xfa, 0xf2, 0x2c, 0xfd, 0x8e, 0x85, 0x52, 0xe4, 0x56, 0x5d, 0x38,
+    0xab, 0xb1, 0x59, 0x74, 0xe2, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x42, 0xe4, 0x56, 0x5e, 0xd5, 0x76,
+    0x2b, 0x2f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x4f, 0xff, 0xd3, 0xad, 0x15, 0x97, 0xb5, 0x5d,
+    0x8a, 0xcb, 0xda, 0xbe, 0xb2, 0x2c, 0xfe, 0xab, 0xa1, 0x54, 0xb9, 0x15, 0x97, 0x4e, 0x2a, 0xec,
+    0x36, 0x5e, 0xd5, 0xd1, 0x16, 0x7b, 0xf4, 0x2a, 0x1f, 0x17, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3,
+    0xe9, 0xc5, 0x7e, 0x65, 0x16, 0x7f, 0x9a, 0x74, 0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xab, 0x91, 0x59,
+    0xfb, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xa8, 0x7f, 0xff, 0xd4, 0xf9, 0xfa, 0x2b, 0x3f, 0x6a, 0xfb,
+    0x2a, 0x4b, 0xbf, 0x7a, 0xfc, 0x8f, 0x8d, 0xd7, 0x37, 0xd5, 0xbf, 0xed, 0xff, 0x00, 0xfd, 0xb4,
+    0xdf, 0x87, 0x3f, 0x79, 0x0a, 0xbf, 0xf6, 0xef, 0xea, 0x55, 0x96, 0xef, 0xde, 0xaa, 0x49, 0x77,
+    0xef, 0x5f, 0x9b, 0x46, 0x07, 0xb3, 0x5e, 0x99, 0x56, 0x4b, 0xbf, 0x7a, 0xab, 0x25, 0xdf, 0xbd,
+    0x76, 0x46, 0x07, 0xce, 0xd7, 0xa6, 0x79, 0x44, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xfe,
+    0xa8, 0x8b, 0x3e, 0xee, 0x85, 0x43, 0xff, 0xd5, 0xc1, 0x8a, 0xcf, 0xa7, 0x15, 0x76, 0x2b, 0x3e,
+    0x9c, 0x57, 0xaf, 0x16, 0x7e, 0xb1, 0x42, 0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5,
+    0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x85, 0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0xd1, 0x16,
+    0x7b, 0xf4, 0x2a, 0x17, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x86, 0xcf, 0xda, 0xba, 0x22, 0xcf, 0x7e,
+    0x85, 0x43, 0xff, 0xd6, 0xf9, 0xa6, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0x4e, 0x2b, 0xc0, 0x8b,
+    0x3f, 0x08, 0xa1, 0x50, 0xbb, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xba, 0x22, 0xcf, 0x7e,
+    0x85, 0x42, 0xec, 0x56, 0x7e, 0xd5, 0xf4, 0x94, 0x97, 0x7e, 0xf5, 0xf9, 0xf7, 0x18, 0x2e, 0x6f,
+    0xab, 0xff, 0x00, 0xdb, 0xdf, 0xfb, 0x69, 0xfa, 0xf7, 0x07, 0xfe, 0xf2, 0x18, 0x8f, 0xfb, 0x77,
+    0xff, 0x00, 0x6e, 0x2a, 0xcb, 0x77, 0xef, 0x55, 0x64, 0xbb, 0xf7, 0xaf, 0x81, 0x8c, 0x0f, 0xad,
+    0xaf, 0x4c, 0xff, 0xd7, 0xbf, 0x25, 0xdf, 0xbd, 0x55, 0x92, 0xef, 0xde, 0xbf, 0x9d, 0x63, 0x03,
+    0xd1, 0xaf, 0x4c, 0xc0, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed, 0x5f, 0xd2, 0x71, 0x67, 0xa7,
+    0x42, 0xa1, 0x72, 0x2b, 0x3e, 0x9c, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x5d, 0x11, 0x67, 0xbf, 0x42,
+    0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x87, 0xff,
+    0xd0, 0xec, 0x62, 0xb3, 0xf6, 0xab, 0xb1, 0x59, 0xfb, 0x57, 0xd0, 0xc5, 0x9f, 0xd0, 0x34, 0x2a,
+    0x17, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x8a, 0xcf, 0xda, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x43, 0xe2,
+    0xf8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7d, 0x38, 0xaf, 0xcc, 0xa2, 0xcf, 0xf3, 0x4e, 0x85, 0x42,
+    0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0f, 0xff, 0xd1,
+    0xf3, 0x88, 0xac, 0xfd, 0xab, 0xba, 0xff, 0x00, 0x84, 0xd2, 0x49, 0x3f, 0xe5, 0xcb, 0x1f, 0xf6,
+    0xd7, 0xff, 0x00, 0xb1, 0xaf, 0x8a, 0xcd, 0x32, 0xaf, 0xed, 0x4f, 0x67, 0xef, 0xf2, 0xf2, 0xdf,
+    0xa5, 0xf7, 0xb7, 0x9a, 0xec, 0x7c, 0xc7, 0x0f, 0x67, 0xcb, 0x28, 0x55, 0x13, 0xa7, 0xcf, 0xcf,
+    0x6e, 0xb6, 0xb5, 0xaf, 0xe4, 0xfb, 0x8a, 0x3c, 0x4b, 0x24, 0xbf, 0xf2, 0xed, 0x8f, 0xf8, 0x1f,
+    0xff, 0x00, 0x5a, 0x97, 0xfb, 0x56, 0x49, 0x3f, 0xe5, 0x96, 0x3f, 0xe0, 0x5f, 0xfd, 0x6a, 0xf2,
+    0x23, 0xc2, 0x8b, 0xfe, 0x7f, 0x7f, 0xe4, 0xbf, 0xfd, 0xb1, 0xf5, 0xdf, 0xeb, 0x44, 0x6b, 0x7f,
+    0xcb, 0x9b, 0x7f, 0xdb, 0xdf, 0xfd, 0xa8, 0xbe, 0x74, 0x92, 0x7f, 0x0e, 0x3f, 0x1a, 0x51, 0x6b,
+    0x24, 0x9f, 0xc5, 0x8f, 0xc2, 0xba, 0xa3, 0xc2, 0xcb, 0xfe, 0x7f, 0x7f, 0xe4, 0xbf, 0xfd, 0xb0,
+    0xbf, 0xb4, 0xa3, 0x5b, 0xec, 0x5b, 0xe7, 0xff, 0x00, 0x00, 0xbb, 0x15, 0x9f, 0xb5, 0x5c, 0x8a,
+    0xcf, 0xda, 0xbf, 0x46, 0x8b, 0x3a, 0x68, 0x54, 0x3f, 0xff, 0xd2, 0xdd, 0x8a, 0xcf, 0xa7, 0x15,
+    0x72, 0x2b, 0x3e, 0x9c, 0x57, 0x64, 0x59, 0xf5, 0xd4, 0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xab, 0x91,
+    0x59, 0xfb, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xed,
+    0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa1, 0x72, 0x2b, 0x3e, 0x9c, 0x55, 0xd8, 0x6c, 0xfd, 0xab, 0xa2,
+    0x2c, 0xf7, 0xe8, 0x54, 0x3f, 0xff, 0xd3, 0xf2, 0x38, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7d, 0x38,
+    0xaf, 0x95, 0x8b, 0x3f, 0x97, 0xe8, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xae,
+    0x88, 0xb3, 0xdf, 0xa1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xba, 0x22, 0xcf,
+    0x7e, 0x85, 0x42, 0xec, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3e, 0x9c, 0x57, 0x44, 0x59, 0xef, 0xd0,
+    0xa8, 0x7f, 0xff, 0xd4, 0xb1, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xb9, 0xa2, 0xcf, 0x9b,
+    0xa1, 0x50, 0xbb, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x42,
+    0xec, 0x56, 0x7d, 0x38, 0xab, 0x91, 0x59, 0xf4, 0xe2, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x42, 0xec,
+    0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0f, 0xff, 0xd5, 0xf6,
+    0xc8, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e, 0xd5, 0xeb, 0xc5, 0x9f, 0xac, 0x50, 0xa8, 0x5c, 0x8a,
+    0xcf, 0xa7, 0x15, 0x76, 0x1b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0f, 0x8b, 0xe2, 0xb2,
+    0xf6, 0xab, 0xb1, 0x59, 0x74, 0xe2, 0xbf, 0x31, 0x8b, 0x3f, 0xcd, 0x3a, 0x15, 0x4b, 0x91, 0x59,
+    0x7b, 0x55, 0xd8, 0xac, 0xbd, 0xab, 0xa2, 0x2c, 0xf7, 0xe8, 0x55, 0x3f, 0xff, 0xd6, 0xa5, 0x15,
+    0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xda, 0xbc, 0x08, 0xb3, 0xf0, 0x8a, 0x15, 0x0b, 0x90, 0xd9, 0x7b,
+    0x55, 0xc8, 0xac, 0xba, 0x71, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa9, 0x76, 0x2b, 0x2f, 0x6a, 0xb9,
+    0x15, 0x97, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0xa5, 0xd8, 0xac, 0xbd, 0xaa, 0xe4, 0x56, 0x5e,
+    0xd5, 0xd1, 0x16, 0x7b, 0xf4, 0x2a, 0x1f, 0xff, 0xd7, 0xf5, 0x78, 0xac, 0xba, 0x71, 0x57, 0x22,
+    0xb2, 0xe9, 0xc5, 0x38, 0xb3, 0x5a, 0x15, 0x4b, 0xb1, 0x59, 0x7b, 0x55, 0xc8, 0xac, 0xbd, 0xab,
+    0xa2, 0x2c, 0xf7, 0xe8, 0x55, 0x2e, 0xc5, 0x65, 0xed, 0x57, 0x22, 0xb2, 0xf6, 0xae, 0x88, 0xb3,
+    0xdf, 0xa1, 0x50, 0xb9, 0x15, 0x97, 0x4e, 0x2a, 0xec, 0x56, 0x5e, 0xd5, 0xd1, 0x16, 0x7b, 0xf4,
+    0x2a, 0x9f, 0xff, 0xd0, 0xe7, 0x62, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x74, 0xe2, 0xbe, 0x2e, 0x2c,
+    0xfe, 0x35, 0xa1, 0x54, 0xb9, 0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xda, 0xba, 0x22, 0xcf, 0x7e,
+    0x85, 0x52, 0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x4b,
+    0x90, 0xd9, 0x7b, 0x55, 0xd8, 0xac, 0xba, 0x71, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa9, 0xff, 0xd1,
+    0xf4, 0x28, 0xac, 0xbd, 0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0xe5, 0xc5, 0x9f, 0x98, 0xd0, 0xaa, 0x5d,
+    0x8a, 0xcb, 0xda, 0xae, 0x45, 0x65, 0xed, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa9, 0x76, 0x2b, 0x2e,
+    0x9c, 0x55, 0xc8, 0xac, 0xba, 0x71, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa9, 0x76, 0x2b, 0x2f, 0x6a,
+    0xb9, 0x15, 0x97, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0xa7, 0xff, 0xd2, 0xfa, 0x9a, 0x2b, 0x2f,
+    0x6a, 0xb9, 0x15, 0x97, 0xb5, 0x76, 0x45, 0x9f, 0x5d, 0x42, 0xa9, 0x72, 0x2b, 0x2e, 0x9c, 0x55,
+    0xd8, 0x6c, 0xbd, 0xab, 0xa2, 0x2c, 0xf7, 0xe8, 0x55, 0x3e, 0x2f, 0x8a, 0xcb, 0xda, 0xae, 0xc5,
+    0x65, 0xd3, 0x8a, 0xfc, 0xc6, 0x2c, 0xff, 0x00, 0x35, 0x28, 0x55, 0x2e, 0x45, 0x65, 0xed, 0x57,
+    0x62, 0xb2, 0xf6, 0xae, 0x88, 0xb3, 0xde, 0xa1, 0x50, 0xff, 0xd3, 0xeb, 0x62, 0xb2, 0xf6, 0xab,
+    0xb1, 0x59, 0x7b, 0x57, 0xca, 0xc5, 0x9f, 0xcb, 0xd4, 0x2a, 0x97, 0x21, 0xb2, 0xf6, 0xab, 0xb1,
+    0x59, 0x74, 0xe2, 0xba, 0x62, 0xcf, 0xa0, 0xa1, 0x54, 0xb9, 0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb,
+    0xda, 0xba, 0x22, 0xcf, 0x7e, 0x85, 0x42, 0xe4, 0x56, 0x5e, 0xd5, 0x72, 0x2b, 0x2f, 0x6a, 0xe8,
+    0x8b, 0x3d, 0xfa, 0x15, 0x4f, 0xff, 0xd4, 0xfa, 0x46, 0x2b, 0x2e, 0x9c, 0x55, 0xc8, 0xac, 0xba,
+    0x71, 0x5c, 0xd1, 0x67, 0xcd, 0xd0, 0xaa, 0x5d, 0x8a, 0xcb, 0xda, 0xae, 0x45, 0x65, 0xed, 0x5d,
+    0x11, 0x67, 0xbf, 0x42, 0xa1, 0x76, 0x2b, 0x2f, 0x6a, 0xb9, 0x15, 0x97, 0xb5, 0x74, 0x45, 0x9e,
+    0xfd, 0x0a, 0xa5, 0xd8, 0xac, 0xba, 0x71, 0x57, 0x21, 0xb2, 0xf6, 0xae, 0x88, 0xb3, 0xdf, 0xa1,
+    0x54, 0xff, 0xd5, 0xd8, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xd3, 0x8a, 0xf8, 0x08, 0xb3, 0xf8,
+    0x32, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15,
+    0x0b, 0x91, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfd, 0xab, 0xa2, 0x2c, 0xf7, 0xe8, 0x54, 0x2e, 0x43,
+    0x67, 0xed, 0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x87, 0xff, 0xd6, 0xf7,
+    0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0xe0, 0x45, 0x9f, 0x84, 0x50, 0xa8, 0x5c, 0x8a,
+    0xcf, 0xda, 0xae, 0x45, 0x67, 0xed, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa1, 0x76, 0x2b, 0x3e, 0x9c,
+    0x55, 0xc8, 0xac, 0xfa, 0x71, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa1, 0x76, 0x2b, 0x3f, 0x6a, 0xb9,
+    0x15, 0x9f, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x87, 0xff, 0xd7, 0xfb, 0x82, 0x2b, 0x3f, 0x6a,
+    0xb9, 0x15, 0x9f, 0xb5, 0x38, 0xb3, 0x5a, 0x15, 0x0b, 0xb1, 0x59, 0xf4, 0xe2, 0xae, 0x45, 0x67,
+    0xed, 0x5d, 0x11, 0x67, 0xbf, 0x42, 0xa1, 0xf1, 0x7c, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3e, 0x9c,
+    0x57, 0xe6, 0x51, 0x67, 0xf9, 0xa7, 0x42, 0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5,
+    0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x87, 0xff, 0xd0, 0xf6, 0x78, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e,
+    0xd5, 0xf1, 0x71, 0x67, 0xf1, 0xad, 0x0a, 0x85, 0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7d, 0x38,
+    0xae, 0x88, 0xb3, 0xdf, 0xa1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xba, 0x22,
+    0xcf, 0x7e, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa,
+    0x15, 0x0f, 0xff, 0xd1, 0xfb, 0x2e, 0x2b, 0x3e, 0x9c, 0x55, 0xc8, 0xac, 0xfa, 0x71, 0x5e, 0x5c,
+    0x59, 0xf9, 0x8d, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e, 0xd5, 0xd1, 0x16, 0x7b,
+    0xf4, 0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xab, 0x91, 0x59, 0xfb, 0x57, 0x44, 0x59, 0xef, 0xd0, 0xa8,
+    0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0x72, 0x1b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0f, 0xff,
+    0xd2, 0xf5, 0x38, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7d, 0x38, 0xaf, 0xcd, 0x62, 0xcf, 0xf3, 0x8a,
+    0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0b,
+    0x91, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfd, 0xab, 0xa2, 0x2c, 0xf7, 0xe8, 0x54, 0x2e, 0x43, 0x67,
+    0xed, 0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x87, 0xff, 0xd3, 0xfa, 0xda,
+    0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x7c, 0xac, 0x59, 0xfc, 0xbd, 0x42, 0xa1, 0x72, 0x2b,
+    0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x85, 0xc8, 0xac, 0xfa, 0x71,
+    0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x74, 0x45, 0x9e, 0xfd, 0x0a, 0x85, 0xc8, 0xac, 0xfd, 0xaa, 0xec,
+    0x56, 0x7e, 0xd5, 0xd1, 0x16, 0x7b, 0xf4, 0x2a, 0x1f, 0xff, 0xd4, 0xfd, 0x1a, 0x8a, 0xcf, 0xda,
+    0xae, 0x45, 0x67, 0xed, 0x5c, 0xb1, 0x67, 0xcd, 0x50, 0xa8, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0x72,
+    0x1b, 0x3f, 0x6a, 0xe8, 0x8b, 0x3d, 0xfa, 0x15, 0x0f, 0xff, 0xd9,
+};
+const unsigned int jpeg_sample_422_len = 3147;
+
+const unsigned char jpeg_sample_444[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06,
+    0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11,
+    0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18,
+    0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05,
+    0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x78, 0x00,
+    0xa0, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00,
+    0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5,
+    0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01,
+    0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61,
+    0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1,
+    0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05,
+    0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42,
+    0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24,
+    0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8,
+    0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03,
+    0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc, 0xbb, 0x8a, 0xcf, 0xda, 0x92, 0x64,
+    0xc2, 0xa1, 0x72, 0x2b, 0x3e, 0x9c, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xb4,
+    0x4c, 0xf4, 0x21, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xc8, 0xac, 0xfd,
+    0xab, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0xb1, 0x59, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5c, 0x86,
+    0xcf, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xbb, 0x15, 0x9f, 0x4e, 0x2b, 0x44, 0xce, 0xf8, 0x54,
+    0x2e, 0x45, 0x67, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xb4, 0x4c, 0xef,
+    0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xab, 0x44,
+    0xce, 0xf8, 0x54, 0x2e, 0x45, 0x67, 0xd3, 0x8a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xec, 0x56, 0x7d,
+    0x38, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x76,
+    0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9e, 0x84, 0x2a,
+    0x17, 0x62, 0xb3, 0xf6, 0xad, 0x53, 0x3b, 0xe1, 0x50, 0xb9, 0x15, 0x9f, 0x4e, 0x2b, 0x44, 0xcf,
+    0x42, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x55, 0xa6, 0x77, 0xc2, 0xa1, 0xf1, 0x84, 0x56, 0x7e, 0xd5,
+    0xf9, 0x72, 0x67, 0xf9, 0x89, 0x0a, 0x85, 0xc8, 0xac, 0xfa, 0x71, 0x5a, 0x26, 0x77, 0xc2, 0xa1,
+    0x76, 0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0x7c,
+    0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x5a, 0x26,
+    0x77, 0xc2, 0xa1, 0x76, 0x1b, 0x3f, 0x6a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x7d, 0x38,
+    0xad, 0x13, 0x3d, 0x08, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0xa1, 0x76, 0x2b,
+    0x3f, 0x6a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x17,
+    0x62, 0xb3, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x54, 0x2e, 0x45, 0x67, 0xd3, 0x8a, 0xd1, 0x33, 0xbe,
+    0x15, 0x0b, 0xb1, 0x59, 0xf4, 0xe2, 0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68,
+    0x99, 0xdf, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xab, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0x91, 0x59, 0xfb,
+    0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xb9, 0x15,
+    0x9f, 0x4e, 0x2b, 0x44, 0xce, 0xf8, 0x54, 0x2e, 0xc3, 0x67, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0xa8,
+    0x7c, 0x5f, 0x15, 0x97, 0xb5, 0x7e, 0x5c, 0x99, 0xfe, 0x61, 0xc2, 0xa1, 0x72, 0x2b, 0x2e, 0x9c,
+    0x56, 0x89, 0x9e, 0x84, 0x2a, 0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xb9, 0x15,
+    0x97, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x76, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x4b,
+    0x91, 0x59, 0x7b, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3b, 0xe1,
+    0x50, 0xb9, 0x15, 0x97, 0x4e, 0x2b, 0x44, 0xcf, 0x42, 0x15, 0x4b, 0x91, 0x59, 0x7b, 0x56, 0x89,
+    0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcb, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xb9, 0x15, 0x97, 0xb5,
+    0x68, 0x99, 0xdf, 0x0a, 0xa5, 0xd8, 0xac, 0xbd, 0xab, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0x91, 0x59,
+    0x74, 0xe2, 0xb4, 0x4c, 0xef, 0x85, 0x42, 0xec, 0x56, 0x5d, 0x38, 0xad, 0x13, 0x3d, 0x08, 0x55,
+    0x2e, 0x45, 0x65, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0xa1, 0x76, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xd0,
+    0x85, 0x42, 0xe4, 0x56, 0x5e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13,
+    0x3d, 0x08, 0x54, 0x2e, 0x45, 0x65, 0xd3, 0x8a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0xb0, 0xd9, 0x7b,
+    0x56, 0x89, 0x9e, 0x84, 0x2a, 0x9f, 0x17, 0xc5, 0x65, 0xed, 0x5f, 0x96, 0xa6, 0x7f, 0x98, 0x90,
+    0xaa, 0x5c, 0x8a, 0xcb, 0xa7, 0x15, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13,
+    0x3b, 0xe1, 0x54, 0xb9, 0x15, 0x97, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa9, 0x76, 0x2b, 0x2f, 0x6a,
+    0xd1, 0x33, 0xbe, 0x15, 0x4f, 0x52, 0x4f, 0xd9, 0xb3, 0xe2, 0x02, 0x75, 0xf0, 0xf8, 0x1f, 0xf6,
+    0xfb, 0x6f, 0xff, 0x00, 0xc7, 0x2b, 0xe4, 0x97, 0x18, 0xe4, 0x7f, 0xf3, 0xff, 0x00, 0xff, 0x00,
+    0x25, 0x9f, 0xff, 0x00, 0x22, 0x7a, 0xb1, 0x53, 0x8e, 0xe8, 0x9d, 0x3f, 0x67, 0x7f, 0x1d, 0xa7,
+    0xde, 0xd0, 0x80, 0xff, 0x00, 0xb7, 0xcb, 0x7f, 0xfe, 0x39, 0x5a, 0x2e, 0x31, 0xc9, 0x3f, 0xe7,
+    0xff, 0x00, 0xfe, 0x4b, 0x3f, 0xfe, 0x44, 0xe8, 0x8d, 0x75, 0x1d, 0xc9, 0xd3, 0xe0, 0x17, 0x8d,
+    0x93, 0xef, 0x68, 0xa0, 0x7f, 0xdb, 0xdc, 0x1f, 0xfc, 0x5d, 0x68, 0xb8, 0xc3, 0x24, 0xff, 0x00,
+    0x9f, 0xff, 0x00, 0xf9, 0x2c, 0xff, 0x00, 0xf9, 0x13, 0x78, 0xe3, 0xe8, 0xc7, 0x79, 0x7e, 0x0c,
+    0x9d, 0x3e, 0x06, 0x78, 0xc5, 0x3a, 0xe8, 0xe0, 0x7f, 0xdb, 0xd4, 0x3f, 0xfc, 0x5d, 0x6a, 0xb8,
+    0xc3, 0x24, 0xff, 0x00, 0x9f, 0xff, 0x00, 0xf9, 0x2c, 0xff, 0x00, 0xf9, 0x13, 0xa2, 0x39, 0xbe,
+    0x16, 0x3b, 0xcf, 0xf0, 0x7f, 0xe4, 0x4c, 0x9f, 0x05, 0xfc, 0x56, 0x9d, 0x74, 0xa0, 0x3f, 0xed,
+    0xe6, 0x1f, 0xfe, 0x2e, 0xb4, 0x5c, 0x5f, 0x92, 0x7f, 0xcf, 0xff, 0x00, 0xfc, 0x96, 0x7f, 0xfc,
+    0x89, 0xbc, 0x73, 0xfc, 0x04, 0x77, 0xa9, 0xf8, 0x4b, 0xfc, 0x8e, 0x72, 0x2b, 0x2f, 0x6a, 0xfb,
+    0x44, 0xcf, 0xab, 0x85, 0x52, 0xec, 0x56, 0x5e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x22, 0xb2,
+    0xe9, 0xc5, 0x68, 0x99, 0xe8, 0x42, 0xa9, 0x76, 0x2b, 0x2e, 0x9c, 0x56, 0x89, 0x9d, 0xf0, 0xaa,
+    0x5c, 0x8a, 0xcb, 0xda, 0xb5, 0x4c, 0xf4, 0x21, 0x54, 0xbb, 0x15, 0x97, 0xb5, 0x5a, 0x67, 0x7c,
+    0x2a, 0x97, 0x22, 0xb2, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x55, 0x2e, 0xc5, 0x65, 0xed, 0x5a, 0xa6,
+    0x77, 0xc2, 0xa9, 0x72, 0x2b, 0x2e, 0x9c, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x97, 0x62, 0xb2, 0xf6,
+    0xab, 0x4c, 0xef, 0x85, 0x53, 0xe2, 0xf8, 0xac, 0xbd, 0xab, 0xf2, 0xe4, 0xcf, 0xf3, 0x12, 0x15,
+    0x0b, 0x91, 0x59, 0x74, 0xe2, 0xb4, 0x4c, 0xef, 0x85, 0x42, 0xec, 0x56, 0x5e, 0xd5, 0xa2, 0x67,
+    0xa1, 0x0a, 0xa5, 0xc8, 0xac, 0xbd, 0xab, 0x44, 0xce, 0xf8, 0x54, 0x2e, 0xc5, 0x65, 0xed, 0x5a,
+    0x26, 0x7a, 0x10, 0xa8, 0x7e, 0x81, 0x49, 0x79, 0xef, 0x5f, 0xc9, 0x0a, 0x07, 0xdf, 0x54, 0xa6,
+    0x54, 0x96, 0xf3, 0xde, 0xb6, 0x50, 0x3c, 0xea, 0x94, 0xca, 0xb2, 0x5e, 0x7b, 0xd6, 0xca, 0x07,
+    0x9b, 0x52, 0x99, 0x56, 0x4b, 0xcf, 0x7a, 0xd9, 0x40, 0xf3, 0xaa, 0x53, 0x2a, 0xc9, 0x79, 0xef,
+    0x5a, 0xa8, 0x1e, 0x75, 0x4a, 0x67, 0xce, 0x11, 0x59, 0x7b, 0x57, 0xf5, 0xc2, 0x67, 0xec, 0x90,
+    0xa8, 0x5d, 0x8a, 0xcb, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x52, 0xe4, 0x56, 0x5d, 0x38, 0xad, 0x13,
+    0x3d, 0x08, 0x54, 0x2e, 0xc5, 0x65, 0xd3, 0x8a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x5e,
+    0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x54, 0x2e, 0x45,
+    0x65, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0xa1, 0x76, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xd0, 0x85, 0x52,
+    0xe4, 0x56, 0x5d, 0x38, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xbb, 0x0d, 0x97, 0xb5, 0x68, 0x99, 0xe8,
+    0x42, 0xa1, 0xf1, 0x7c, 0x56, 0x7e, 0xd5, 0xf9, 0x72, 0x67, 0xf9, 0x87, 0x0a, 0x85, 0xc8, 0xac,
+    0xfa, 0x71, 0x5a, 0x26, 0x7a, 0x10, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x42,
+    0xe4, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xab, 0x44, 0xce, 0xf8,
+    0x54, 0x3e, 0xca, 0x92, 0xef, 0xde, 0xbf, 0x97, 0x14, 0x0f, 0xd9, 0xaa, 0x53, 0x2a, 0xcb, 0x77,
+    0xef, 0x5b, 0x28, 0x1e, 0x75, 0x4a, 0x65, 0x49, 0x2e, 0xfd, 0xeb, 0x65, 0x03, 0xce, 0xa9, 0x4c,
+    0xab, 0x25, 0xdf, 0xbd, 0x6c, 0xa0, 0x79, 0xd5, 0x29, 0x95, 0x64, 0xbb, 0xf7, 0xad, 0x94, 0x0f,
+    0x36, 0xa5, 0x33, 0xca, 0x22, 0xb3, 0xf6, 0xaf, 0xea, 0x34, 0xcf, 0xbc, 0x85, 0x42, 0xec, 0x56,
+    0x7e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xc8, 0xac, 0xfa, 0x71, 0x5a, 0x26, 0x77, 0xc2, 0xa1,
+    0x76, 0x2b, 0x3e, 0x9c, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x22, 0xb3, 0xf6, 0xad, 0x13, 0x3b,
+    0xe1, 0x50, 0xbb, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xd1,
+    0x33, 0xbe, 0x15, 0x0b, 0xb1, 0x59, 0xfb, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x22, 0xb3, 0xe9,
+    0xc5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xd8, 0x6c, 0xfd, 0xab, 0x44, 0xcf, 0x42, 0x15, 0x0f, 0x8b,
+    0xe2, 0xb3, 0xf6, 0xaf, 0xcb, 0x53, 0x3f, 0xcc, 0x38, 0x54, 0x2e, 0x45, 0x67, 0xd3, 0x8a, 0xd1,
+    0x33, 0xd0, 0x85, 0x42, 0xec, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x17, 0x22, 0xb3, 0xf6,
+    0xad, 0x13, 0x3d, 0x08, 0x54, 0x2e, 0xc5, 0x67, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0xa1, 0xf4, 0x94,
+    0x97, 0x7e, 0xf5, 0xfc, 0xe4, 0xa0, 0x7f, 0x47, 0x54, 0xa6, 0x55, 0x96, 0xef, 0xde, 0xb5, 0x50,
+    0x3c, 0xea, 0x94, 0xca, 0xb2, 0x5d, 0xfb, 0xd6, 0xca, 0x07, 0x9d, 0x52, 0x99, 0x52, 0x4b, 0xbf,
+    0x7a, 0xd9, 0x40, 0xf3, 0xaa, 0x53, 0x2a, 0xc9, 0x77, 0xef, 0x5b, 0x28, 0x1e, 0x6d, 0x4a, 0x66,
+    0x04, 0x56, 0x7e, 0xd5, 0xfd, 0x1c, 0x99, 0xea, 0x42, 0xa1, 0x76, 0x2b, 0x3f, 0x6a, 0xd1, 0x33,
+    0xd0, 0x85, 0x42, 0xe4, 0x56, 0x7d, 0x38, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xbb, 0x15, 0x9f, 0x4e,
+    0x2b, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x62,
+    0xb3, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa1,
+    0x76, 0x2b, 0x3f, 0x6a, 0xd5, 0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xf4, 0xe2, 0xad, 0x33, 0xd0,
+    0x85, 0x42, 0xec, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x1f, 0x17, 0xc5, 0x67, 0xed, 0x5f,
+    0x97, 0x26, 0x7f, 0x98, 0x90, 0xa8, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0xa2, 0x67, 0x7c, 0x2a, 0x17,
+    0x22, 0xb3, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xbb, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42,
+    0xa1, 0x72, 0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0e, 0xeb, 0xfe, 0x13, 0x49, 0x24, 0xff,
+    0x00, 0x97, 0x2c, 0x7f, 0xdb, 0x5f, 0xfe, 0xc6, 0xbe, 0x09, 0x70, 0x9a, 0xff, 0x00, 0x9f, 0xff,
+    0x00, 0xf9, 0x2f, 0xff, 0x00, 0x6c, 0x7e, 0xbd, 0xfe, 0xbc, 0xc6, 0x7f, 0xf3, 0x0d, 0xff, 0x00,
+    0x93, 0xff, 0x00, 0xf6, 0xa2, 0x8f, 0x12, 0xc9, 0x2f, 0xfc, 0xbb, 0x63, 0xfe, 0x07, 0xff, 0x00,
+    0xd6, 0xad, 0x57, 0x0a, 0x2f, 0xf9, 0xff, 0x00, 0xff, 0x00, 0x92, 0xff, 0x00, 0xf6, 0xc1, 0xfe,
+    0xb7, 0x46, 0x7f, 0xf2, 0xe3, 0xff, 0x00, 0x26, 0xff, 0x00, 0xed, 0x45, 0xfe, 0xd5, 0x92, 0x4f,
+    0xf9, 0x65, 0x8f, 0xf8, 0x17, 0xff, 0x00, 0x5a, 0xb5, 0x5c, 0x2a, 0xbf, 0xe7, 0xf7, 0xfe, 0x4b,
+    0xff, 0x00, 0xdb, 0x0b, 0xfd, 0x62, 0x8c, 0xff, 0x00, 0xe5, 0xd7, 0xfe, 0x4d, 0xff, 0x00, 0x00,
+    0x5f, 0x3a, 0x49, 0x3f, 0x87, 0x1f, 0x8d, 0x6a, 0xb8, 0x55, 0x7f, 0xcf, 0xef, 0xfc, 0x97, 0xff,
+    0x00, 0xb6, 0x17, 0xf6, 0xbc, 0x67, 0xff, 0x00, 0x2e, 0xff, 0x00, 0x1f, 0xf8, 0x02, 0x8b, 0x59,
+    0x24, 0xfe, 0x2c, 0x7e, 0x15, 0xa2, 0xe1, 0x65, 0xff, 0x00, 0x3f, 0xbf, 0xf2, 0x5f, 0xfe, 0xd8,
+    0x5f, 0x5c, 0x8c, 0xfe, 0xcf, 0xe2, 0x5d, 0x8a, 0xcf, 0xda, 0xbf, 0x42, 0x4c, 0xb8, 0x54, 0x2e,
+    0x45, 0x67, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0xa1, 0x76, 0x2b, 0x3e, 0x9c, 0x56, 0x89, 0x9e, 0x84,
+    0x2a, 0x17, 0x22, 0xb3, 0xe9, 0xc5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xab, 0x44,
+    0xcf, 0x42, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcf, 0xda,
+    0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xc8, 0xac,
+    0xfa, 0x71, 0x5a, 0x26, 0x7a, 0x10, 0xa8, 0x5d, 0x86, 0xcf, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x43,
+    0xe2, 0xf8, 0xac, 0xfd, 0xab, 0xf2, 0xd4, 0xcf, 0xf3, 0x12, 0x15, 0x0b, 0xb1, 0x59, 0xf4, 0xe2,
+    0xb4, 0x4c, 0xef, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac,
+    0xfd, 0xab, 0x54, 0xce, 0xf8, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x56, 0x99, 0xe8, 0x42, 0xa1, 0x72,
+    0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0xb1, 0x59, 0xfb, 0x56, 0xa9, 0x9e, 0x84, 0x2a,
+    0x17, 0x22, 0xb3, 0xe9, 0xc5, 0x5a, 0x67, 0x7c, 0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xad, 0x13, 0x3d,
+    0x08, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x5a, 0xa6, 0x77, 0xc2, 0xa1, 0x76, 0x2b, 0x3f, 0x6a, 0xd1,
+    0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x17, 0x62, 0xb3, 0xe9,
+    0xc5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x72, 0x2b, 0x3e, 0x9c, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17,
+    0x62, 0xb3, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42,
+    0xa1, 0x76, 0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9e,
+    0x84, 0x2a, 0x17, 0x22, 0xb3, 0xe9, 0xc5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xd8, 0x6c, 0xfd, 0xab,
+    0x44, 0xcf, 0x42, 0x15, 0x0f, 0x8b, 0xe2, 0xb2, 0xf6, 0xaf, 0xcb, 0x53, 0x3f, 0xcc, 0x38, 0x55,
+    0x2e, 0xc5, 0x65, 0xd3, 0x8a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x5e, 0xd5, 0xa2, 0x67,
+    0x7c, 0x2a, 0x17, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x55, 0x2e, 0x45, 0x65, 0xed, 0x5a,
+    0x26, 0x77, 0xc2, 0xa1, 0x76, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x36, 0x5e,
+    0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x22, 0xb2, 0xe9, 0xc5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x76,
+    0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0x7b, 0x56, 0x89, 0x9e, 0x84, 0x2a,
+    0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xb9, 0x15, 0x97, 0xb5, 0x68, 0x99, 0xe8,
+    0x42, 0xa1, 0x76, 0x2b, 0x2e, 0x9c, 0x56, 0x89, 0x9d, 0xf0, 0xaa, 0x5c, 0x8a, 0xcb, 0xa7, 0x15,
+    0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac, 0xbd, 0xab, 0x44, 0xce, 0xf8, 0x54, 0x2e, 0x45, 0x65,
+    0xed, 0x5a, 0x26, 0x7a, 0x10, 0xaa, 0x5d, 0x8a, 0xcb, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x42, 0xe4,
+    0x56, 0x5e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xc8, 0xac, 0xba, 0x71, 0x5a, 0x26, 0x77, 0xc2,
+    0xa9, 0x76, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xd0, 0x85, 0x43, 0xe2, 0xf8, 0xac, 0xbd, 0xab, 0xf2,
+    0xe4, 0xcf, 0xf3, 0x12, 0x15, 0x4b, 0xb1, 0x59, 0x74, 0xe2, 0xb4, 0x4c, 0xef, 0x85, 0x52, 0xe4,
+    0x56, 0x5e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x55,
+    0x2e, 0x45, 0x65, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0xa9, 0x76, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xd0,
+    0x85, 0x52, 0xe4, 0x36, 0x5e, 0xd5, 0xa2, 0x67, 0x7c, 0x2a, 0x97, 0x62, 0xb2, 0xe9, 0xc5, 0x68,
+    0x99, 0xe8, 0x42, 0xa9, 0x72, 0x2b, 0x2f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x4b, 0x91, 0x59, 0x7b,
+    0x56, 0x89, 0x9e, 0x84, 0x2a, 0x97, 0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x54, 0xb9, 0x15,
+    0x97, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa9, 0x76, 0x2b, 0x2e, 0x9c, 0x56, 0x89, 0x9d, 0xf0, 0xaa,
+    0x5c, 0x8a, 0xcb, 0xa7, 0x15, 0xa2, 0x67, 0xa1, 0x0a, 0xa5, 0xd8, 0xac, 0xbd, 0xab, 0x44, 0xcf,
+    0x42, 0x15, 0x4b, 0x91, 0x59, 0x7b, 0x56, 0x89, 0x9d, 0xf0, 0xaa, 0x5d, 0x8a, 0xcb, 0xda, 0xb4,
+    0x4c, 0xf4, 0x21, 0x54, 0xb9, 0x15, 0x97, 0xb5, 0x68, 0x99, 0xdf, 0x0a, 0xa5, 0xc8, 0xac, 0xba,
+    0x71, 0x5a, 0x26, 0x7a, 0x10, 0xaa, 0x5d, 0x86, 0xcb, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x53, 0xe2,
+    0xf8, 0xac, 0xbd, 0xab, 0xf2, 0xd4, 0xcf, 0xf3, 0x12, 0x15, 0x0b, 0xb1, 0x59, 0x74, 0xe2, 0xb4,
+    0x4c, 0xef, 0x85, 0x52, 0xe4, 0x56, 0x5e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac, 0xbd,
+    0xab, 0x44, 0xce, 0xf8, 0x54, 0x2e, 0x45, 0x65, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0xaa, 0x5d, 0x8a,
+    0xcb, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x42, 0xe4, 0x36, 0x5e, 0xd5, 0xaa, 0x67, 0xa1, 0x0a, 0x85,
+    0xd8, 0xac, 0xba, 0x71, 0x56, 0x99, 0xdf, 0x0a, 0xa5, 0xc8, 0xac, 0xbd, 0xab, 0x44, 0xcf, 0x42,
+    0x15, 0x0b, 0xb1, 0x59, 0x7b, 0x56, 0xa9, 0x9d, 0xf0, 0xa8, 0x5c, 0x8a, 0xcb, 0xda, 0xb4, 0x4c,
+    0xf4, 0x21, 0x54, 0xb9, 0x15, 0x97, 0xb5, 0x5a, 0x67, 0x7c, 0x2a, 0x17, 0x62, 0xb2, 0xe9, 0xc5,
+    0x6a, 0x99, 0xe8, 0x42, 0xa1, 0x72, 0x2b, 0x2e, 0x9c, 0x56, 0x89, 0x9d, 0xf0, 0xaa, 0x5d, 0x8a,
+    0xcb, 0xda, 0xad, 0x33, 0xd0, 0x85, 0x42, 0xe4, 0x56, 0x5e, 0xd5, 0xaa, 0x67, 0x7c, 0x2a, 0x17,
+    0x62, 0xb2, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x55, 0x2e, 0x45, 0x65, 0xed, 0x5a, 0x26, 0x77, 0xc2,
+    0xa1, 0x76, 0x2b, 0x2e, 0x9c, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x21, 0xb2, 0xf6, 0xad, 0x13,
+    0x3b, 0xe1, 0x54, 0xf8, 0xbe, 0x2b, 0x3f, 0x6a, 0xfc, 0xb5, 0x33, 0xfc, 0xc4, 0x85, 0x42, 0xec,
+    0x56, 0x7d, 0x38, 0xad, 0x13, 0x3d, 0x08, 0x54, 0x2e, 0x45, 0x67, 0xed, 0x5a, 0x26, 0x77, 0xc2,
+    0xa1, 0x76, 0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9e,
+    0x84, 0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xb9, 0x0d, 0x9f, 0xb5, 0x68,
+    0x99, 0xe8, 0x42, 0xa1, 0x76, 0x2b, 0x3e, 0x9c, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x22, 0xb3,
+    0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x50, 0xbb, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x72,
+    0x2b, 0x3f, 0x6a, 0xd1, 0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9e, 0x84, 0x2a,
+    0x17, 0x62, 0xb3, 0xe9, 0xc5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xc8, 0xac, 0xfa, 0x71, 0x5a, 0x26,
+    0x7a, 0x10, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x42, 0xe4, 0x56, 0x7e, 0xd5,
+    0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xab, 0x44, 0xce, 0xf8, 0x54, 0x2e, 0x45, 0x67,
+    0xed, 0x5a, 0x26, 0x7a, 0x10, 0xa8, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0xa2, 0x67, 0x7c, 0x2a, 0x17,
+    0x22, 0xb3, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x54, 0x3e, 0x2f, 0x8a, 0xcf, 0xda, 0xbf, 0x2e, 0x4c,
+    0xff, 0x00, 0x30, 0xe1, 0x50, 0xbb, 0x15, 0x9f, 0x4e, 0x2b, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0x91,
+    0x59, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcf, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x50,
+    0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xd8, 0xac, 0xfd, 0xab, 0x44, 0xcf, 0x42,
+    0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0xa2,
+    0x67, 0xa1, 0x0a, 0x85, 0xc8, 0xac, 0xfd, 0xab, 0x44, 0xce, 0xf8, 0x54, 0x2e, 0xc5, 0x67, 0xed,
+    0x5a, 0x26, 0x7a, 0x10, 0xa8, 0x5c, 0x8a, 0xcf, 0xda, 0xb4, 0x4c, 0xef, 0x85, 0x42, 0xe4, 0x56,
+    0x7e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xd8, 0xac, 0xfa, 0x71, 0x5a, 0x26, 0x77, 0xc2, 0xa1,
+    0x72, 0x2b, 0x3e, 0x9c, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x62, 0xb3, 0xf6, 0xad, 0x13, 0x3b,
+    0xe1, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0xa1, 0x76, 0x2b, 0x3f, 0x6a, 0xd1,
+    0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9e, 0x84, 0x2a, 0x17, 0x62, 0xb3, 0xe9,
+    0xc5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xc8, 0x6c, 0xfd, 0xab, 0x44, 0xcf, 0x42, 0x15, 0x0f, 0x8c,
+    0x22, 0xb3, 0xf6, 0xaf, 0xcb, 0x53, 0x3f, 0xcc, 0x48, 0x54, 0x2e, 0x45, 0x67, 0xd3, 0x8a, 0xd1,
+    0x33, 0xbe, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d, 0x8a, 0xcf, 0xda,
+    0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xb9, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xdf, 0x0a, 0x85, 0xd8, 0xac,
+    0xfd, 0xab, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0x90, 0xd9, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0xa8, 0x5d,
+    0x8a, 0xcf, 0xa7, 0x15, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xc8, 0xac, 0xfd, 0xab, 0x44, 0xce, 0xf8,
+    0x54, 0x2e, 0xc5, 0x67, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0xa8, 0x5c, 0x8a, 0xcf, 0xda, 0xb4, 0x4c,
+    0xef, 0x85, 0x42, 0xec, 0x56, 0x7e, 0xd5, 0xa2, 0x67, 0xa1, 0x0a, 0x85, 0xc8, 0xac, 0xfa, 0x71,
+    0x5a, 0xa6, 0x77, 0xc2, 0xa1, 0x76, 0x2b, 0x3e, 0x9c, 0x55, 0xa6, 0x7a, 0x10, 0xa8, 0x5c, 0x8a,
+    0xcf, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x50, 0xbb, 0x15, 0x9f, 0xb5, 0x68, 0x99, 0xdf, 0x0a, 0x85,
+    0xc8, 0xac, 0xfd, 0xab, 0x44, 0xcf, 0x42, 0x15, 0x0b, 0x91, 0x59, 0xfb, 0x56, 0x89, 0x9d, 0xf0,
+    0xa8, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0xaa, 0x67, 0xa1, 0x0a, 0x85, 0xc8, 0x6c, 0xfd, 0xaa, 0xd3,
+    0x3b, 0xe1, 0x50, 0xff, 0xd9,
+};
+const unsigned int jpeg_sample_444_len = 3605;
+
+const unsigned char jpeg_sample_gray[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06,
+    0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11,
+    0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18,
+    0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05,
+    0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x78, 0x00,
+    0xa0, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03,
+    0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04,
+    0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+    0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82,
+    0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00,
+    0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4,
+    0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+    0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51,
+    0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23,
+    0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18,
+    0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2,
+    0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9,
+    0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5,
+    0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xfc,
+    0xbb, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xd3, 0x8a, 0xbb, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf,
+    0xda, 0xae, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xab, 0x90, 0xd9, 0xfb, 0x55, 0xd8, 0xac,
+    0xfa, 0x71, 0x57, 0x22, 0xb3, 0xf6, 0xab, 0xb1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xaa, 0xec,
+    0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3e, 0x9c, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x57, 0x22, 0xb3, 0xf6,
+    0xab, 0xb1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3e,
+    0x9c, 0x55, 0xc8, 0xac, 0xfd, 0xab, 0xe3, 0x08, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7d, 0x38, 0xab,
+    0xb1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3f, 0x6a,
+    0xbb, 0x0d, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xa7, 0x15, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f,
+    0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x8a,
+    0xcf, 0xa7, 0x15, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xae,
+    0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x86, 0xcf, 0xda, 0xbe, 0x2f, 0x8a, 0xcb,
+    0xda, 0xae, 0x45, 0x65, 0xd3, 0x8a, 0xbb, 0x15, 0x97, 0xb5, 0x5c, 0x8a, 0xcb, 0xda, 0xae, 0xc5,
+    0x65, 0xed, 0x57, 0x22, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b, 0x55, 0xc8, 0xac, 0xba, 0x71, 0x57,
+    0x22, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b, 0x55, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5,
+    0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xba, 0x71, 0x57, 0x22, 0xb2, 0xf6, 0xab, 0xb1, 0x59,
+    0x7b, 0x55, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8,
+    0x6c, 0xbd, 0xab, 0xe2, 0xf8, 0xac, 0xbd, 0xaa, 0xe4, 0x56, 0x5d, 0x38, 0xab, 0xb1, 0x59, 0x7b,
+    0x55, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0xea, 0x49, 0xfb, 0x36, 0x7c, 0x40, 0x4e,
+    0xbe, 0x1f, 0x03, 0xfe, 0xdf, 0x6d, 0xff, 0x00, 0xf8, 0xe5, 0x4e, 0x9f, 0xb3, 0xbf, 0x8e, 0xd3,
+    0xef, 0x68, 0x40, 0x7f, 0xdb, 0xe5, 0xbf, 0xff, 0x00, 0x1c, 0xa9, 0xd3, 0xe0, 0x17, 0x8d, 0x93,
+    0xef, 0x68, 0xa0, 0x7f, 0xdb, 0xdc, 0x1f, 0xfc, 0x5d, 0x4e, 0x9f, 0x03, 0x3c, 0x62, 0x9d, 0x74,
+    0x70, 0x3f, 0xed, 0xea, 0x1f, 0xfe, 0x2e, 0xa6, 0x4f, 0x82, 0xfe, 0x2b, 0x4e, 0xba, 0x50, 0x1f,
+    0xf6, 0xf3, 0x0f, 0xff, 0x00, 0x17, 0x5c, 0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xb9,
+    0x15, 0x97, 0x4e, 0x2a, 0xec, 0x56, 0x5d, 0x38, 0xab, 0x91, 0x59, 0x7b, 0x55, 0xd8, 0xac, 0xbd,
+    0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xb9, 0x15, 0x97, 0x4e, 0x2a, 0xec, 0x56,
+    0x5e, 0xd5, 0xf1, 0x7c, 0x56, 0x5e, 0xd5, 0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xbd, 0xaa,
+    0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xfd, 0x02, 0x92, 0xf3, 0xde, 0xaa, 0x4b, 0x79,
+    0xef, 0x55, 0x64, 0xbc, 0xf7, 0xaa, 0xb2, 0x5e, 0x7b, 0xd5, 0x59, 0x2f, 0x3d, 0xeb, 0xe7, 0x08,
+    0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e, 0xd5, 0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xba, 0x71,
+    0x57, 0x22, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x7b, 0x55, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e,
+    0xd5, 0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0x6c, 0xbd, 0xab, 0xe2, 0xf8, 0xac, 0xfd, 0xaa, 0xe4,
+    0x56, 0x7d, 0x38, 0xab, 0xb1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5,
+    0xf6, 0x54, 0x97, 0x7e, 0xf5, 0x56, 0x5b, 0xbf, 0x7a, 0xa9, 0x25, 0xdf, 0xbd, 0x55, 0x92, 0xef,
+    0xde, 0xaa, 0xc9, 0x77, 0xef, 0x5e, 0x51, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xae, 0x45,
+    0x67, 0xd3, 0x8a, 0xbb, 0x15, 0x9f, 0x4e, 0x2a, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a,
+    0xb9, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xd3, 0x8a, 0xbb, 0x0d, 0x9f,
+    0xb5, 0x7c, 0x5f, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xa7, 0x15, 0x76, 0x2b, 0x3f, 0x6a, 0xb9,
+    0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xbe, 0x92, 0x92, 0xef, 0xde, 0xaa, 0xcb, 0x77, 0xef,
+    0x55, 0x64, 0xbb, 0xf7, 0xaa, 0x92, 0x5d, 0xfb, 0xd5, 0x59, 0x2e, 0xfd, 0xeb, 0x02, 0x2b, 0x3f,
+    0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xa7, 0x15, 0x76, 0x2b, 0x3e, 0x9c, 0x55, 0xc8,
+    0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0x72, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0xb5, 0x5c,
+    0x8a, 0xcf, 0xa7, 0x15, 0x76, 0x2b, 0x3f, 0x6a, 0xf8, 0xbe, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f,
+    0x4e, 0x2a, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5, 0x77, 0x5f,
+    0xf0, 0x9a, 0x49, 0x27, 0xfc, 0xb9, 0x63, 0xfe, 0xda, 0xff, 0x00, 0xf6, 0x34, 0xa3, 0xc4, 0xb2,
+    0x4b, 0xff, 0x00, 0x2e, 0xd8, 0xff, 0x00, 0x81, 0xff, 0x00, 0xf5, 0xa9, 0x7f, 0xb5, 0x64, 0x93,
+    0xfe, 0x59, 0x63, 0xfe, 0x05, 0xff, 0x00, 0xd6, 0xa5, 0xf3, 0xa4, 0x93, 0xf8, 0x71, 0xf8, 0xd2,
+    0x8b, 0x59, 0x24, 0xfe, 0x2c, 0x7e, 0x15, 0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5, 0x5d,
+    0x8a, 0xcf, 0xa7, 0x15, 0x72, 0x2b, 0x3e, 0x9c, 0x55, 0xd8, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e,
+    0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xa7, 0x15, 0x76, 0x1b,
+    0x3f, 0x6a, 0xf8, 0xbe, 0x2b, 0x3f, 0x6a, 0xbb, 0x15, 0x9f, 0x4e, 0x2a, 0xe4, 0x56, 0x7e, 0xd5,
+    0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5, 0x5c, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed,
+    0x57, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3,
+    0xf6, 0xab, 0x91, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x57, 0x22, 0xb3, 0xe9, 0xc5, 0x5d,
+    0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xf6, 0xab, 0x91, 0x59, 0xfb, 0x55,
+    0xc8, 0xac, 0xfa, 0x71, 0x57, 0x61, 0xb3, 0xf6, 0xaf, 0x8b, 0xe2, 0xb2, 0xf6, 0xab, 0xb1, 0x59,
+    0x74, 0xe2, 0xae, 0x45, 0x65, 0xed, 0x57, 0x62, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x55, 0xd8,
+    0xac, 0xbd, 0xaa, 0xe4, 0x36, 0x5e, 0xd5, 0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xbd, 0xaa,
+    0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xb9, 0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xa7,
+    0x15, 0x72, 0x2b, 0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xbd, 0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b,
+    0x2f, 0x6a, 0xb9, 0x15, 0x97, 0xb5, 0x5c, 0x8a, 0xcb, 0xa7, 0x15, 0x76, 0x2b, 0x2f, 0x6a, 0xf8,
+    0xbe, 0x2b, 0x2f, 0x6a, 0xbb, 0x15, 0x97, 0x4e, 0x2a, 0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f,
+    0x6a, 0xb9, 0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xda, 0xae, 0x43, 0x65, 0xed, 0x57, 0x62, 0xb2,
+    0xe9, 0xc5, 0x5c, 0x8a, 0xcb, 0xda, 0xae, 0x45, 0x65, 0xed, 0x57, 0x62, 0xb2, 0xf6, 0xab, 0x91,
+    0x59, 0x7b, 0x55, 0xd8, 0xac, 0xba, 0x71, 0x57, 0x22, 0xb2, 0xe9, 0xc5, 0x5d, 0x8a, 0xcb, 0xda,
+    0xae, 0x45, 0x65, 0xed, 0x57, 0x62, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x55, 0xc8, 0xac, 0xba,
+    0x71, 0x57, 0x61, 0xb2, 0xf6, 0xaf, 0x8b, 0xe2, 0xb2, 0xf6, 0xab, 0xb1, 0x59, 0x74, 0xe2, 0xae,
+    0x45, 0x65, 0xed, 0x57, 0x62, 0xb2, 0xf6, 0xab, 0x91, 0x59, 0x7b, 0x55, 0xd8, 0xac, 0xbd, 0xaa,
+    0xe4, 0x36, 0x5e, 0xd5, 0x76, 0x2b, 0x2e, 0x9c, 0x55, 0xc8, 0xac, 0xbd, 0xaa, 0xec, 0x56, 0x5e,
+    0xd5, 0x72, 0x2b, 0x2f, 0x6a, 0xb9, 0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xa7, 0x15, 0x72, 0x2b,
+    0x2e, 0x9c, 0x55, 0xd8, 0xac, 0xbd, 0xaa, 0xe4, 0x56, 0x5e, 0xd5, 0x76, 0x2b, 0x2f, 0x6a, 0xb9,
+    0x15, 0x97, 0xb5, 0x5d, 0x8a, 0xcb, 0xa7, 0x15, 0x72, 0x1b, 0x2f, 0x6a, 0xf8, 0xbe, 0x2b, 0x3f,
+    0x6a, 0xbb, 0x15, 0x9f, 0x4e, 0x2a, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15,
+    0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xda, 0xae, 0x43, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x5c,
+    0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xf6, 0xab, 0x91, 0x59, 0xfb, 0x55,
+    0xd8, 0xac, 0xfa, 0x71, 0x57, 0x22, 0xb3, 0xe9, 0xc5, 0x5d, 0x8a, 0xcf, 0xda, 0xae, 0x45, 0x67,
+    0xed, 0x57, 0x62, 0xb3, 0xf6, 0xab, 0x91, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x57, 0x22,
+    0xb3, 0xf6, 0xaf, 0x8b, 0xe2, 0xb3, 0xf6, 0xab, 0xb1, 0x59, 0xf4, 0xe2, 0xae, 0x45, 0x67, 0xed,
+    0x57, 0x62, 0xb3, 0xf6, 0xab, 0x91, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e,
+    0xd5, 0x76, 0x2b, 0x3e, 0x9c, 0x55, 0xc8, 0xac, 0xfd, 0xaa, 0xec, 0x56, 0x7e, 0xd5, 0x72, 0x2b,
+    0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5, 0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0x72, 0x2b, 0x3e, 0x9c, 0x55,
+    0xd8, 0xac, 0xfd, 0xaa, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5,
+    0x5d, 0x8a, 0xcf, 0xa7, 0x15, 0x72, 0x1b, 0x3f, 0x6a, 0xf8, 0xc2, 0x2b, 0x3f, 0x6a, 0xb9, 0x15,
+    0x9f, 0x4e, 0x2a, 0xe4, 0x56, 0x7e, 0xd5, 0x76, 0x2b, 0x3f, 0x6a, 0xb9, 0x15, 0x9f, 0xb5, 0x5d,
+    0x8a, 0xcf, 0xda, 0xae, 0x43, 0x67, 0xed, 0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x5c, 0x8a, 0xcf, 0xda,
+    0xae, 0xc5, 0x67, 0xed, 0x57, 0x22, 0xb3, 0xf6, 0xab, 0xb1, 0x59, 0xfb, 0x55, 0xc8, 0xac, 0xfa,
+    0x71, 0x57, 0x62, 0xb3, 0xe9, 0xc5, 0x5c, 0x8a, 0xcf, 0xda, 0xae, 0xc5, 0x67, 0xed, 0x57, 0x22,
+    0xb3, 0xf6, 0xab, 0x91, 0x59, 0xfb, 0x55, 0xd8, 0xac, 0xfa, 0x71, 0x57, 0x21, 0xb3, 0xf6, 0xaf,
+    0xff, 0xd9,
+};
+const unsigned int jpeg_sample_gray_len = 1986;
+
+const unsigned char jpeg_sample_qvga[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06,
+    0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11,
+    0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18,
+    0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05,
+    0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0xf0, 0x01,
+    0x40, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00,
+    0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5,
+    0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01,
+    0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61,
+    0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1,
+    0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05,
+    0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42,
+    0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24,
+    0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8,
+    0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03,
+    0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc, 0xb2, 0x48, 0x6a, 0x64, 0x86, 0x9a,
+    0x2a, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xad, 0x1e, 0x84, 0x24, 0x4e, 0x90, 0xd4, 0xc9, 0x0d,
+    0x68, 0x8e, 0xf8, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1e, 0x84, 0x24, 0x4c, 0x90, 0xd4,
+    0xe9, 0x0d, 0x68, 0x8e, 0xf8, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1e, 0x84, 0x24, 0x4c,
+    0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8e, 0xf8, 0x48, 0x9d, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x33, 0xd0,
+    0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0xa4, 0x35, 0x32, 0x43, 0x5a,
+    0x23, 0xd0, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x3a,
+    0x43, 0x5a, 0x23, 0xd0, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64,
+    0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x3a, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1,
+    0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x3a, 0x43, 0x53, 0x24, 0x35, 0xa2,
+    0x3b, 0xe1, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4e, 0x90,
+    0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x47, 0xc3, 0x6b,
+    0x0f, 0xb5, 0x4c, 0x90, 0xfb, 0x57, 0xe6, 0x29, 0x9f, 0xe6, 0x7c, 0x24, 0x4c, 0x90, 0xfb, 0x54,
+    0xc9, 0x0f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xc9, 0x0f, 0xb5, 0x4e, 0x90, 0xfb, 0x56, 0x89,
+    0x9d, 0xf0, 0x91, 0x32, 0x43, 0xed, 0x53, 0x24, 0x3e, 0xd5, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24,
+    0x3e, 0xd5, 0x3a, 0x43, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xc9, 0x0f, 0xb5, 0x4c, 0x90, 0xfb,
+    0x56, 0x89, 0x9e, 0x84, 0x24, 0x4c, 0x90, 0xfb, 0x54, 0xc9, 0x0f, 0xb5, 0x68, 0x99, 0xdf, 0x09,
+    0x13, 0xa4, 0x3e, 0xd5, 0x32, 0x43, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x43, 0xed, 0x53,
+    0x24, 0x3e, 0xd5, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0xfb, 0x54, 0xe9, 0x0f, 0xb5, 0x68, 0x99,
+    0xe8, 0x42, 0x44, 0xc9, 0x0f, 0xb5, 0x4c, 0x90, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0x32, 0x43,
+    0xed, 0x53, 0x24, 0x3e, 0xd5, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0xa4, 0x3e, 0xd5, 0x32, 0x43, 0xed,
+    0x5a, 0x26, 0x77, 0xc2, 0x44, 0xc9, 0x0f, 0xb5, 0x4c, 0x90, 0xfb, 0x56, 0x89, 0x9e, 0x84, 0x24,
+    0x4e, 0x90, 0xfb, 0x54, 0xc9, 0x0f, 0xb5, 0x68, 0x99, 0xdf, 0x09, 0x13, 0x24, 0x3e, 0xd5, 0x32,
+    0x43, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x43, 0xed, 0x53, 0xa4, 0x3e, 0xd5, 0xa2, 0x67,
+    0x7c, 0x24, 0x4c, 0x90, 0xfb, 0x54, 0xc9, 0x0f, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xc9, 0x0f,
+    0xb5, 0x4c, 0x90, 0xfb, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0x3a, 0x43, 0xed, 0x53, 0x24, 0x3e, 0xd5,
+    0xa2, 0x67, 0xa1, 0x09, 0x1f, 0x0e, 0x2c, 0x35, 0x32, 0x43, 0x5f, 0x98, 0x23, 0xfc, 0xce, 0x84,
+    0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x3a, 0x43, 0x5a, 0x23,
+    0xd0, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x3a, 0x43,
+    0x5a, 0x23, 0xd0, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35,
+    0x32, 0x43, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x3a, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x22,
+    0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0xa4, 0x35, 0xa2, 0x3b,
+    0xe1, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35,
+    0xa2, 0x67, 0x7c, 0x24, 0x4e, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a,
+    0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4e, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26,
+    0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x8e, 0xf8,
+    0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1e, 0x84, 0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68,
+    0x8e, 0xf8, 0x48, 0x9d, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1e, 0x84, 0x24, 0x7c, 0x36, 0xb0, 0x7b,
+    0x54, 0xc9, 0x07, 0xb5, 0x7e, 0x62, 0x99, 0xfe, 0x67, 0xc2, 0x44, 0xc9, 0x07, 0xb5, 0x4c, 0x90,
+    0x7b, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0x32, 0x41, 0xed, 0x53, 0xa4, 0x1e, 0xd5, 0xa2, 0x67, 0xa1,
+    0x09, 0x13, 0x24, 0x1e, 0xd5, 0x32, 0x41, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xc9, 0x07, 0xb5,
+    0x4e, 0x90, 0x7b, 0x56, 0x89, 0x9e, 0x84, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xc9, 0x07, 0xb5, 0x68,
+    0x99, 0xdf, 0x09, 0x13, 0x24, 0x1e, 0xd5, 0x32, 0x41, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x3a,
+    0x41, 0xed, 0x53, 0x24, 0x1e, 0xd5, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xc9, 0x07,
+    0xb5, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xc9, 0x07, 0xb5, 0x4e, 0x90, 0x7b, 0x56, 0x89, 0x9d, 0xf0,
+    0x91, 0x32, 0x41, 0xed, 0x53, 0x24, 0x1e, 0xd5, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24, 0x1e, 0xd5,
+    0x32, 0x41, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xe9, 0x07, 0xb5, 0x4c, 0x90, 0x7b, 0x56, 0x89,
+    0x9e, 0x84, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xc9, 0x07, 0xb5, 0x68, 0x99, 0xdf, 0x09, 0x13, 0xa4,
+    0x1e, 0xd5, 0x32, 0x41, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x41, 0xed, 0x53, 0x24, 0x1e,
+    0xd5, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xe9, 0x07, 0xb5, 0x68, 0x99, 0xdf, 0x09,
+    0x13, 0x24, 0x1e, 0xd5, 0x32, 0x41, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x41, 0xed, 0x53,
+    0x24, 0x1e, 0xd5, 0xa2, 0x67, 0x7c, 0x24, 0x4e, 0x90, 0x7b, 0x54, 0xc9, 0x07, 0xb5, 0x68, 0x99,
+    0xe8, 0x42, 0x47, 0xc3, 0x69, 0x0d, 0x4e, 0x90, 0xd7, 0xe6, 0x08, 0xff, 0x00, 0x33, 0xa1, 0x22,
+    0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b,
+    0xe1, 0x22, 0x74, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35,
+    0xa2, 0x3b, 0xe1, 0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x6a,
+    0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26,
+    0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x8f, 0x42,
+    0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad,
+    0x11, 0xdf, 0x09, 0x13, 0xa4, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xd0, 0x84, 0x89, 0x92, 0x1a, 0x99,
+    0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x3a, 0x43, 0x5a, 0x23, 0xd0, 0x84, 0x89, 0x92,
+    0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xd0, 0x84,
+    0x89, 0xd2, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23,
+    0xd0, 0x84, 0x89, 0xd2, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x1f, 0x0d, 0xac, 0x15, 0x32,
+    0x41, 0x5f, 0x98, 0x26, 0x7f, 0x99, 0xf0, 0x91, 0x32, 0x41, 0x53, 0x24, 0x15, 0xa2, 0x67, 0xa1,
+    0x09, 0x13, 0xa4, 0x15, 0x32, 0x41, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xc9, 0x05, 0x4c, 0x90, 0x56,
+    0x89, 0x9d, 0xf0, 0x91, 0x32, 0x41, 0x53, 0xa4, 0x15, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24, 0x15,
+    0x32, 0x41, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xc9, 0x05, 0x4c, 0x90, 0x56, 0x89, 0x9e, 0x84, 0x24,
+    0x4e, 0x90, 0x54, 0xc9, 0x05, 0x68, 0x99, 0xdf, 0x09, 0x13, 0x24, 0x15, 0x32, 0x41, 0x5a, 0x26,
+    0x7a, 0x10, 0x91, 0x32, 0x41, 0x53, 0xa4, 0x15, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0x54, 0xc9,
+    0x05, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xc9, 0x05, 0x4e, 0x90, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0x32,
+    0x41, 0x53, 0x24, 0x15, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24, 0x15, 0x32, 0x41, 0x5a, 0x26, 0x77,
+    0xc2, 0x44, 0xe9, 0x05, 0x4c, 0x90, 0x56, 0x89, 0x9e, 0x84, 0x24, 0x4c, 0x90, 0x54, 0xc9, 0x05,
+    0x68, 0x99, 0xdf, 0x09, 0x13, 0x24, 0x15, 0x3a, 0x41, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x41,
+    0x53, 0x24, 0x15, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0x54, 0xe9, 0x05, 0x68, 0x99, 0xe8, 0x42,
+    0x44, 0xc9, 0x05, 0x4c, 0x90, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0xf0, 0xda, 0xc3, 0x53, 0x24, 0x35,
+    0xf9, 0x8a, 0x3f, 0xcc, 0xf8, 0x48, 0x9d, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d, 0xf0, 0x91, 0x32,
+    0x43, 0x53, 0x24, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0x9d, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d, 0xf0,
+    0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x3a, 0x43, 0x5a,
+    0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xc9,
+    0x0d, 0x68, 0x8f, 0x42, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90,
+    0xd4, 0xc9, 0x0d, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x88, 0xef, 0x84,
+    0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x88,
+    0xef, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4c, 0x90,
+    0xd6, 0x88, 0xef, 0x84, 0x89, 0xd2, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d,
+    0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0xd2, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44,
+    0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x9d, 0x21, 0xad, 0x11, 0xe8,
+    0x42, 0x47, 0xc3, 0x69, 0x05, 0x4c, 0x90, 0x57, 0xe6, 0x09, 0x9f, 0xe6, 0x74, 0x24, 0x4c, 0x90,
+    0x54, 0xc9, 0x05, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xe9, 0x05, 0x4c, 0x90, 0x56, 0x89, 0x9d, 0xf0,
+    0x91, 0x32, 0x41, 0x53, 0x24, 0x15, 0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24, 0x15, 0x3a, 0x41, 0x5a,
+    0x26, 0x77, 0xc2, 0x47, 0xd2, 0x9f, 0xf0, 0xc7, 0x0a, 0xbf, 0xf3, 0x37, 0x67, 0xfe, 0xe1, 0x9f,
+    0xfd, 0xba, 0x8f, 0xf8, 0x64, 0x05, 0x5f, 0xf9, 0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00, 0xdb, 0x6b,
+    0xf2, 0x05, 0xe2, 0x27, 0xfd, 0x42, 0x7f, 0xe4, 0xff, 0x00, 0xfd, 0xa1, 0xed, 0xfb, 0x17, 0x0e,
+    0xa2, 0xff, 0x00, 0xc3, 0x24, 0x2a, 0xff, 0x00, 0xcc, 0xd7, 0x9f, 0xfb, 0x87, 0x7f, 0xf6, 0xda,
+    0x3f, 0xe1, 0x93, 0xd5, 0x7f, 0xe6, 0x69, 0xcf, 0xfd, 0xc3, 0xff, 0x00, 0xfb, 0x6d, 0x6a, 0xbc,
+    0x43, 0xff, 0x00, 0xa8, 0x4f, 0xfc, 0x9f, 0xff, 0x00, 0xb4, 0x17, 0xb5, 0x70, 0xe8, 0x2f, 0xfc,
+    0x32, 0xba, 0xaf, 0xfc, 0xcc, 0xf9, 0xff, 0x00, 0xb8, 0x7f, 0xff, 0x00, 0x6d, 0xa5, 0xff, 0x00,
+    0x86, 0x5f, 0x55, 0xff, 0x00, 0x99, 0x97, 0x3f, 0xf6, 0xe1, 0xff, 0x00, 0xdb, 0x6b, 0x45, 0xe2,
+    0x1f, 0xfd, 0x42, 0x7f, 0xe4, 0xff, 0x00, 0xfd, 0xa0, 0xbf, 0xb4, 0x5c, 0x3e, 0xc7, 0xe3, 0xff,
+    0x00, 0x00, 0x3f, 0xe1, 0x99, 0x95, 0x7f, 0xe6, 0x64, 0xcf, 0xfd, 0xb8, 0xff, 0x00, 0xf6, 0xca,
+    0x5f, 0xf8, 0x66, 0xe5, 0x5f, 0xf9, 0x98, 0xb3, 0xff, 0x00, 0x6e, 0x3f, 0xfd, 0xb2, 0xb5, 0x5e,
+    0x21, 0x7f, 0xd4, 0x2f, 0xfe, 0x4f, 0xff, 0x00, 0xda, 0x07, 0xf6, 0xe3, 0x87, 0xfc, 0xbb, 0xfc,
+    0x7f, 0xe0, 0x07, 0xfc, 0x33, 0xb2, 0xaf, 0xfc, 0xcc, 0x19, 0xff, 0x00, 0xb7, 0x2f, 0xfe, 0xd9,
+    0x4b, 0xff, 0x00, 0x0c, 0xfc, 0xab, 0xff, 0x00, 0x31, 0xec, 0xff, 0x00, 0xdb, 0x9f, 0xff, 0x00,
+    0x6c, 0xad, 0x57, 0x88, 0x5f, 0xf5, 0x0b, 0xff, 0x00, 0x93, 0xff, 0x00, 0xf6, 0x82, 0xff, 0x00,
+    0x59, 0xdc, 0x3f, 0xe5, 0xcf, 0xfe, 0x4d, 0xff, 0x00, 0xda, 0x9e, 0x54, 0x90, 0x54, 0xc9, 0x05,
+    0x7e, 0xc8, 0x99, 0xfa, 0x2c, 0x24, 0x4c, 0x90, 0x54, 0xe9, 0x05, 0x68, 0x99, 0xe8, 0x42, 0x44,
+    0xc9, 0x05, 0x4c, 0x90, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0x32, 0x41, 0x53, 0x24, 0x15, 0xa2, 0x67,
+    0xa1, 0x09, 0x13, 0xa4, 0x15, 0x32, 0x41, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xc9, 0x05, 0x4c, 0x90,
+    0x56, 0x89, 0x9e, 0x84, 0x24, 0x4c, 0x90, 0x54, 0xe9, 0x05, 0x68, 0x99, 0xdf, 0x09, 0x13, 0x24,
+    0x15, 0x32, 0x41, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x41, 0x53, 0xa4, 0x15, 0xa2, 0x67, 0x7c,
+    0x24, 0x4c, 0x90, 0x54, 0xc9, 0x05, 0x68, 0x99, 0xe8, 0x42, 0x47, 0xc3, 0x6b, 0x0d, 0x4c, 0x90,
+    0xd7, 0xe6, 0x08, 0xff, 0x00, 0x33, 0xa1, 0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b, 0x44, 0x7a, 0x10,
+    0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b, 0x44,
+    0xcf, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x7e, 0x87, 0xb4, 0xb5,
+    0x0b, 0x4b, 0x5f, 0xc8, 0x8a, 0x27, 0xda, 0x54, 0x89, 0x13, 0x4b, 0x51, 0x34, 0xb5, 0xaa, 0x89,
+    0xe7, 0x54, 0x89, 0x13, 0x4b, 0x51, 0x34, 0xb5, 0xb2, 0x89, 0xe7, 0x54, 0x89, 0x13, 0x4b, 0x51,
+    0x34, 0xb5, 0xb2, 0x89, 0xe7, 0x54, 0x89, 0x13, 0x4b, 0x51, 0x34, 0xb5, 0xb2, 0x89, 0xe7, 0x54,
+    0x89, 0xf3, 0x12, 0x43, 0x53, 0xa4, 0x35, 0xfd, 0x78, 0x8f, 0xdb, 0x61, 0x22, 0x64, 0x86, 0xa6,
+    0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x74,
+    0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21,
+    0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88,
+    0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xe9, 0x0d, 0x4c, 0x90,
+    0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0xce, 0xf8, 0x48, 0xf8, 0x71,
+    0x60, 0xa9, 0x92, 0x0a, 0xfc, 0xc5, 0x33, 0xfc, 0xcf, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad,
+    0x13, 0x3b, 0xe1, 0x22, 0x74, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x2a,
+    0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x9d, 0x20, 0xad, 0x13, 0x3d, 0x08, 0x48,
+    0xfb, 0xc9, 0xa6, 0xa8, 0x9a, 0x6a, 0xfe, 0x4d, 0x51, 0x3f, 0x48, 0xa9, 0x12, 0x26, 0x9a, 0xa2,
+    0x69, 0xab, 0x65, 0x13, 0xcd, 0xa9, 0x12, 0x26, 0x9a, 0xa2, 0x69, 0xab, 0x65, 0x13, 0xce, 0xa9,
+    0x12, 0x16, 0x9a, 0xa2, 0x69, 0xab, 0x65, 0x13, 0xce, 0xa9, 0x12, 0x26, 0x9a, 0xa2, 0x69, 0xab,
+    0x55, 0x13, 0xce, 0xa9, 0x13, 0xe7, 0xf4, 0x82, 0xa6, 0x48, 0x2b, 0xfa, 0xcd, 0x33, 0xf5, 0x98,
+    0x48, 0x99, 0x20, 0xa9, 0xd2, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad,
+    0x13, 0x3b, 0xe1, 0x22, 0x64, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xcf, 0x42, 0x12, 0x27, 0x48, 0x2a,
+    0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3d, 0x08, 0x48,
+    0x9d, 0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c,
+    0xf4, 0x21, 0x22, 0x64, 0x82, 0xa7, 0x48, 0x2b, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x20, 0xa9, 0x92,
+    0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x8f, 0x86, 0xd2, 0x1a, 0x99, 0x21, 0xaf, 0xcc, 0x11, 0xfe, 0x67,
+    0xc2, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad,
+    0x13, 0x3b, 0xe1, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x3a, 0x43, 0x53,
+    0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x23, 0xed, 0x76, 0x96, 0xa2, 0x69, 0x6b, 0xf9, 0x61, 0x44, 0xfd,
+    0x72, 0xa4, 0x48, 0x9a, 0x5a, 0x89, 0xa5, 0xad, 0x54, 0x4f, 0x3a, 0xa4, 0x48, 0x9a, 0x5a, 0x89,
+    0xa5, 0xad, 0x94, 0x4f, 0x3a, 0xa4, 0x48, 0x5a, 0x5a, 0x89, 0xa5, 0xad, 0x94, 0x4f, 0x3a, 0xa4,
+    0x48, 0x9a, 0x5a, 0x89, 0xa5, 0xad, 0x94, 0x4f, 0x3a, 0xa4, 0x4f, 0x1a, 0x48, 0x6a, 0x64, 0x86,
+    0xbf, 0xaa, 0x11, 0xfa, 0x2c, 0x24, 0x4e, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26,
+    0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x8f, 0x42,
+    0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68,
+    0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xc9,
+    0x0d, 0x68, 0x8f, 0x42, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92,
+    0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x47, 0xc3, 0x8b, 0x07, 0xb5, 0x4c, 0x90, 0x7b, 0x57,
+    0xe6, 0x09, 0x9f, 0xe6, 0x74, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xc9, 0x07, 0xb5, 0x68, 0x99, 0xdf,
+    0x09, 0x13, 0xa4, 0x1e, 0xd5, 0x32, 0x41, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x41, 0xed,
+    0x53, 0x24, 0x1e, 0xd5, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xe9, 0x07, 0xb5, 0x68,
+    0x99, 0xe8, 0x42, 0x47, 0xd7, 0x4d, 0x37, 0xbd, 0x44, 0xd3, 0x7b, 0xd7, 0xf3, 0x12, 0x89, 0xfb,
+    0x85, 0x48, 0x91, 0x34, 0xde, 0xf5, 0x13, 0x4d, 0xef, 0x5b, 0x28, 0x9e, 0x75, 0x48, 0x91, 0x34,
+    0xde, 0xf5, 0x13, 0x4d, 0xef, 0x5b, 0x28, 0x9e, 0x75, 0x48, 0x91, 0x34, 0xde, 0xf5, 0x13, 0x4d,
+    0xef, 0x5b, 0x28, 0x9e, 0x6d, 0x48, 0x90, 0xb4, 0xde, 0xf5, 0x13, 0x4d, 0xef, 0x5b, 0x28, 0x9e,
+    0x75, 0x48, 0x9e, 0x6e, 0x90, 0x7b, 0x54, 0xc9, 0x07, 0xb5, 0x7f, 0x4e, 0xa6, 0x7d, 0x94, 0x24,
+    0x4c, 0x90, 0x7b, 0x54, 0xe9, 0x07, 0xb5, 0x68, 0x99, 0xdf, 0x09, 0x13, 0x24, 0x1e, 0xd5, 0x32,
+    0x41, 0xed, 0x5a, 0x26, 0x7a, 0x10, 0x91, 0x32, 0x41, 0xed, 0x53, 0x24, 0x1e, 0xd5, 0xa2, 0x67,
+    0x7c, 0x24, 0x4e, 0x90, 0x7b, 0x54, 0xc9, 0x07, 0xb5, 0x68, 0x99, 0xe8, 0x42, 0x44, 0xc9, 0x07,
+    0xb5, 0x4c, 0x90, 0x7b, 0x56, 0x89, 0x9d, 0xf0, 0x91, 0x3a, 0x41, 0xed, 0x53, 0x24, 0x1e, 0xd5,
+    0xa2, 0x67, 0xa1, 0x09, 0x13, 0x24, 0x1e, 0xd5, 0x32, 0x41, 0xed, 0x5a, 0x26, 0x77, 0xc2, 0x44,
+    0xc9, 0x07, 0xb5, 0x4e, 0x90, 0x7b, 0x56, 0x89, 0x9e, 0x84, 0x24, 0x4c, 0x90, 0x7b, 0x54, 0xc9,
+    0x07, 0xb5, 0x68, 0x99, 0xdf, 0x09, 0x1f, 0x0d, 0xac, 0x35, 0x32, 0x43, 0x5f, 0x98, 0xa3, 0xfc,
+    0xcf, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x74, 0x86, 0xa6, 0x48,
+    0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x22, 0x64, 0x86,
+    0xa7, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0xf4, 0xfb, 0x4b, 0x51, 0x34, 0xb5, 0xfc, 0xd8, 0xa2,
+    0x7f, 0x41, 0xd4, 0x89, 0x13, 0x4b, 0x51, 0x34, 0xb5, 0xb2, 0x89, 0xe7, 0x54, 0x89, 0x13, 0x4b,
+    0x51, 0x34, 0xb5, 0xaa, 0x89, 0xe7, 0x54, 0x89, 0x13, 0x4b, 0x51, 0x34, 0xb5, 0xb2, 0x89, 0xe7,
+    0x54, 0x89, 0x13, 0x4b, 0x50, 0xb4, 0xb5, 0xb2, 0x89, 0xe7, 0x54, 0x89, 0xc9, 0x24, 0x35, 0x32,
+    0x43, 0x5f, 0xd2, 0x88, 0xf7, 0xa1, 0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44,
+    0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b, 0x44, 0x77,
+    0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b,
+    0x44, 0x77, 0xc2, 0x44, 0xe9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6,
+    0x48, 0x6b, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x21, 0xa9, 0xd2, 0x1a, 0xd1, 0x1e, 0x84, 0x24, 0x4c,
+    0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8e, 0xf8, 0x48, 0xf8, 0x71, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a,
+    0xfc, 0xc1, 0x33, 0xfc, 0xce, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3d,
+    0x08, 0x48, 0x9d, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x7d,
+    0xaa, 0x64, 0x87, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa7, 0x48, 0x7d, 0xab,
+    0x44, 0xce, 0xf8, 0x48, 0xfa, 0x0d, 0xa6, 0xf7, 0xa8, 0x5a, 0x6f, 0x7a, 0xfe, 0x77, 0x51, 0x3f,
+    0xa6, 0x2a, 0x44, 0x89, 0xa6, 0xf7, 0xa8, 0x9a, 0x6f, 0x7a, 0xd5, 0x44, 0xf3, 0xaa, 0x44, 0x89,
+    0xa6, 0xf7, 0xa8, 0x9a, 0x6f, 0x7a, 0xd9, 0x44, 0xf3, 0xaa, 0x44, 0x89, 0xa6, 0xf7, 0xa8, 0x9a,
+    0x6f, 0x7a, 0xd9, 0x44, 0xf3, 0xaa, 0x44, 0x89, 0xa6, 0xf7, 0xa8, 0x9a, 0x6f, 0x7a, 0xd9, 0x44,
+    0xf3, 0x6a, 0x44, 0xce, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xbf, 0xa2, 0x53, 0x3a, 0xa1, 0x22,
+    0x64, 0x87, 0xda, 0xa7, 0x48, 0x7d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92,
+    0x1f, 0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3b,
+    0xe1, 0x22, 0x74, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x7d,
+    0xaa, 0x64, 0x87, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0xd2, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad,
+    0x13, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26,
+    0x48, 0x7d, 0xaa, 0x74, 0x87, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa6, 0x48,
+    0x7d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0xf8, 0x6d, 0x61, 0xa9, 0x92, 0x1a, 0xfc, 0xc5, 0x33, 0xfc,
+    0xcf, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4e, 0x90,
+    0xd6, 0x88, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d,
+    0x4e, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x8f, 0x68, 0x69, 0x6a, 0x26, 0x96, 0xbf, 0x00, 0x51, 0x3f,
+    0xaa, 0xea, 0x44, 0x89, 0xa5, 0xa8, 0x5a, 0x5a, 0xd9, 0x44, 0xf3, 0xaa, 0x44, 0x89, 0xa5, 0xa8,
+    0x9a, 0x5a, 0xd5, 0x44, 0xf3, 0xaa, 0x44, 0x89, 0xa5, 0xa8, 0x9a, 0x5a, 0xd9, 0x44, 0xf3, 0xaa,
+    0x44, 0x89, 0xa5, 0xa8, 0x9a, 0x5a, 0xd9, 0x44, 0xf3, 0xaa, 0x44, 0xb4, 0x90, 0xd4, 0xc9, 0x0d,
+    0x7f, 0x40, 0x23, 0x96, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0xa4,
+    0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09,
+    0x13, 0xa4, 0x35, 0x32, 0x43, 0x56, 0x8e, 0xf8, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd5, 0x1e,
+    0x84, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x99, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43,
+    0x56, 0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4e, 0x90, 0xd4,
+    0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x3e, 0x1c, 0x58, 0x6a, 0x64, 0x86, 0xbf, 0x31, 0x47, 0xf9,
+    0x9d, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86,
+    0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a,
+    0x74, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26,
+    0x48, 0x6a, 0x74, 0x86, 0xad, 0x1d, 0xf0, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3d, 0x08,
+    0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d, 0xf0, 0x91, 0x3a, 0x43, 0x53, 0x24, 0x35, 0xa2,
+    0x3d, 0x08, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d, 0xf0, 0x91, 0x32, 0x43, 0x53, 0xa4,
+    0x35, 0xa2, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d, 0xf0, 0x91, 0x32, 0x43,
+    0x53, 0xa4, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x33, 0xbe, 0x12,
+    0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0xa4, 0x35, 0x32, 0x43, 0x5a, 0x23,
+    0xbe, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0xa4, 0x35, 0x32, 0x43,
+    0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x4c, 0xf4, 0x21, 0x23, 0xe1, 0xb4,
+    0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0xf3, 0x14, 0xcf, 0xf3, 0x3e, 0x12, 0x26, 0x48, 0x7d, 0xaa,
+    0x64, 0x87, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x9d, 0x21, 0xf6, 0xad, 0x13,
+    0x3d, 0x08, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48,
+    0x7d, 0xaa, 0x74, 0x87, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa6, 0x48, 0x7d,
+    0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xd0, 0x84,
+    0x89, 0xd2, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x87, 0xda, 0xa6,
+    0x48, 0x7d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x74, 0x87, 0xda, 0xb4, 0x4c,
+    0xef, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x87,
+    0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x27, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda,
+    0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48,
+    0x9d, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x64,
+    0x87, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa7, 0x48, 0x7d, 0xab, 0x44, 0xce,
+    0xf8, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x1f,
+    0x6a, 0x9d, 0x21, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab,
+    0x44, 0xcf, 0x42, 0x12, 0x3e, 0x1c, 0x48, 0x6a, 0x64, 0x86, 0xbf, 0x30, 0x47, 0xf9, 0x9d, 0x09,
+    0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x74, 0x86, 0xb4, 0x47,
+    0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x74, 0x86,
+    0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a,
+    0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0xa4, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26,
+    0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x3a, 0x43, 0x5a, 0x23, 0xbe,
+    0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a,
+    0x23, 0xbe, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32,
+    0x43, 0x5a, 0x26, 0x77, 0xc2, 0x44, 0xe9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64,
+    0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x88, 0xf4, 0x21,
+    0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x89,
+    0x9e, 0x84, 0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8e, 0xf8, 0x48, 0xf8, 0x6d, 0x60, 0xf6,
+    0xa9, 0x92, 0x0f, 0x6a, 0xfc, 0xc5, 0x33, 0xfc, 0xcf, 0x84, 0x89, 0x92, 0x0f, 0x6a, 0x99, 0x20,
+    0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x74, 0x83, 0xda, 0xa6, 0x48, 0x3d, 0xab, 0x44, 0xcf, 0x42,
+    0x12, 0x26, 0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0f, 0x6a,
+    0x9d, 0x20, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0x92, 0x0f, 0x6a, 0xd1,
+    0x33, 0xbe, 0x12, 0x26, 0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x74,
+    0x83, 0xda, 0xa6, 0x48, 0x3d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0x92, 0x0f,
+    0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x0f, 0x6a, 0x9d, 0x20, 0xf6, 0xad, 0x13, 0x3b, 0xe1,
+    0x22, 0x64, 0x83, 0xda, 0xa6, 0x48, 0x3d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x3d, 0xaa,
+    0x74, 0x83, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0f, 0x6a, 0x99, 0x20, 0xf6, 0xad, 0x13,
+    0x3d, 0x08, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0x92, 0x0f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x27, 0x48,
+    0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x83, 0xda, 0xa6, 0x48, 0x3d,
+    0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0xd2, 0x0f, 0x6a, 0xd1, 0x33, 0xd0, 0x84,
+    0x89, 0x92, 0x0f, 0x6a, 0x99, 0x20, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x83, 0xda, 0xa7,
+    0x48, 0x3d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c,
+    0xef, 0x84, 0x8f, 0x86, 0xd2, 0x1a, 0x9d, 0x21, 0xaf, 0xcc, 0x11, 0xfe, 0x67, 0x42, 0x44, 0xc9,
+    0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2,
+    0x44, 0xe9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44,
+    0x77, 0xc2, 0x44, 0xe9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa6, 0x48,
+    0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86,
+    0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4e, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22,
+    0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4,
+    0x21, 0x22, 0x74, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a,
+    0xd1, 0x1e, 0x84, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x8e, 0xf8, 0x48, 0x99, 0x21, 0xa9,
+    0x92, 0x1a, 0xd1, 0x1e, 0x84, 0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8e, 0xf8, 0x48, 0x9d,
+    0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf,
+    0x09, 0x13, 0xa4, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xd0, 0x84, 0x8f, 0x86, 0xd2, 0x0a, 0x99, 0x20,
+    0xaf, 0xcc, 0x13, 0x3f, 0xcc, 0xe8, 0x48, 0x99, 0x20, 0xa9, 0x92, 0x0a, 0xd5, 0x33, 0xd0, 0x84,
+    0x89, 0xd2, 0x0a, 0x99, 0x20, 0xab, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad, 0x13,
+    0x3d, 0x08, 0x48, 0x99, 0x20, 0xa9, 0xd2, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x2a, 0x64,
+    0x82, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xce, 0xf8, 0x48, 0x9d,
+    0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3b,
+    0xe1, 0x22, 0x64, 0x82, 0xa7, 0x48, 0x2b, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82,
+    0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x9d, 0x20, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x20,
+    0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84,
+    0x89, 0xd2, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x20, 0xa9, 0x92, 0x0a, 0xd1,
+    0x33, 0xbe, 0x12, 0x27, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x82, 0xa6,
+    0x48, 0x2b, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x20, 0xa9, 0xd2, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89,
+    0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3b, 0xe1, 0x23, 0xe1, 0xb5, 0x86, 0xa7, 0x48, 0x6b, 0xf3,
+    0x14, 0x7f, 0x99, 0xf0, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x22, 0x64, 0x86,
+    0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x3a, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x22,
+    0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0xa4, 0x35, 0xa2, 0x3b,
+    0xe1, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35,
+    0xa2, 0x3b, 0xe1, 0x22, 0x74, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53,
+    0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x22, 0x74, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32,
+    0x43, 0x53, 0x24, 0x35, 0xa2, 0x67, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68, 0x8f, 0x42,
+    0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xe9, 0x0d, 0x68,
+    0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xc9,
+    0x0d, 0x68, 0x99, 0xdf, 0x09, 0x13, 0xa4, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xd0, 0x84, 0x89, 0x92,
+    0x1a, 0x99, 0x21, 0xad, 0x11, 0xdf, 0x09, 0x13, 0x24, 0x35, 0x3a, 0x43, 0x5a, 0x23, 0xd0, 0x84,
+    0x8f, 0x86, 0xd2, 0x0a, 0x99, 0x20, 0xaf, 0xcc, 0x13, 0x3f, 0xcc, 0xf8, 0x48, 0x99, 0x20, 0xa9,
+    0x92, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x27, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89,
+    0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x20, 0xa9, 0xd2, 0x0a, 0xd1, 0x33,
+    0xbe, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x82, 0xa6, 0x48,
+    0x2b, 0x44, 0xce, 0xf8, 0x48, 0x9d, 0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92,
+    0x0a, 0x99, 0x20, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x82, 0xa7, 0x48, 0x2b, 0x44, 0xcf, 0x42,
+    0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x9d, 0x20, 0xad,
+    0x13, 0x3d, 0x08, 0x48, 0x99, 0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x2a,
+    0x64, 0x82, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x74, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xce, 0xf8, 0x48,
+    0x99, 0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0xd2, 0x0a, 0x99, 0x20, 0xad, 0x13,
+    0x3b, 0xe1, 0x22, 0x64, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x2a, 0x74,
+    0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3d, 0x08, 0x48, 0xf8,
+    0x6d, 0x21, 0xa9, 0x92, 0x1a, 0xfc, 0xc1, 0x1f, 0xe6, 0x74, 0x24, 0x4e, 0x90, 0xd4, 0xc9, 0x0d,
+    0x68, 0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4,
+    0xe9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c, 0x24, 0x4c,
+    0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0x7c,
+    0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86, 0xb4,
+    0x47, 0x7c, 0x24, 0x4c, 0x90, 0xd4, 0xc9, 0x0d, 0x68, 0x8f, 0x42, 0x12, 0x26, 0x48, 0x6a, 0x74,
+    0x86, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9,
+    0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0xd2, 0x1a, 0x99, 0x21, 0xad, 0x11, 0xe8, 0x42,
+    0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x9d, 0x21, 0xad, 0x13,
+    0x3b, 0xe1, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43, 0x53, 0xa4,
+    0x35, 0xa2, 0x3b, 0xe1, 0x22, 0x64, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x7a, 0x10, 0x91, 0x32, 0x43,
+    0x53, 0x24, 0x35, 0xa2, 0x3b, 0xe1, 0x23, 0xe1, 0xc5, 0x82, 0xa6, 0x48, 0x2b, 0xf3, 0x14, 0xcf,
+    0xf3, 0x3e, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0xd2, 0x0a, 0x99,
+    0x20, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x26,
+    0x48, 0x2a, 0x74, 0x82, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xce,
+    0xf8, 0x48, 0x99, 0x20, 0xa9, 0x92, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0xd2, 0x0a, 0x99, 0x20,
+    0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xcf, 0x42, 0x12, 0x27, 0x48,
+    0x2a, 0x64, 0x82, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3d, 0x08,
+    0x48, 0x99, 0x20, 0xa9, 0xd2, 0x0a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4,
+    0x4c, 0xf4, 0x21, 0x22, 0x64, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xce, 0xf8, 0x48, 0x9d, 0x20, 0xa9,
+    0x92, 0x0a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x0a, 0x99, 0x20, 0xad, 0x13, 0x3b, 0xe1, 0x22,
+    0x74, 0x82, 0xa6, 0x48, 0x2b, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x2a, 0x64, 0x82, 0xb4, 0x4c,
+    0xef, 0x84, 0x89, 0x92, 0x0a, 0x9d, 0x20, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x82, 0xa6, 0x48,
+    0x2b, 0x44, 0xcf, 0x42, 0x12, 0x3e, 0x1b, 0x58, 0x6a, 0x64, 0x86, 0xbf, 0x30, 0x47, 0xf9, 0x9f,
+    0x09, 0x13, 0x24, 0x35, 0x3a, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4,
+    0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x27, 0x48, 0x6a, 0x64,
+    0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x27, 0x48,
+    0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12,
+    0x26, 0x48, 0x6a, 0x74, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x26,
+    0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0xd2, 0x1a, 0x99, 0x21,
+    0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0xd2, 0x1a,
+    0x99, 0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x89, 0x9d, 0xf0, 0x91,
+    0x32, 0x43, 0x53, 0xa4, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d,
+    0xf0, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0x9d, 0x21, 0xa9, 0x92, 0x1a,
+    0xd1, 0x1d, 0xf0, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0xf8, 0x71, 0x20,
+    0xf6, 0xa9, 0x92, 0x0f, 0x6a, 0xfc, 0xc1, 0x33, 0xfc, 0xce, 0x84, 0x89, 0x92, 0x0f, 0x6a, 0x99,
+    0x20, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x9d, 0x20, 0xf6, 0xa9, 0x92, 0x0f, 0x6a, 0xd1, 0x33,
+    0xbe, 0x12, 0x26, 0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x83,
+    0xda, 0xa7, 0x48, 0x3d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0x92, 0x0f, 0x6a,
+    0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22,
+    0x74, 0x83, 0xda, 0xa6, 0x48, 0x3d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0x92,
+    0x0f, 0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0xd2, 0x0f, 0x6a, 0x99, 0x20, 0xf6, 0xad, 0x13, 0x3b,
+    0xe1, 0x22, 0x64, 0x83, 0xda, 0xa6, 0x48, 0x3d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x3d,
+    0xaa, 0x74, 0x83, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x0f, 0x6a, 0x99, 0x20, 0xf6, 0xad,
+    0x13, 0x3d, 0x08, 0x48, 0x99, 0x20, 0xf6, 0xa9, 0xd2, 0x0f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26,
+    0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x83, 0xda, 0xa6, 0x48,
+    0x3d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x9d, 0x20, 0xf6, 0xa9, 0x92, 0x0f, 0x6a, 0xd1, 0x33, 0xd0,
+    0x84, 0x89, 0x92, 0x0f, 0x6a, 0x99, 0x20, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x83, 0xda,
+    0xa7, 0x48, 0x3d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x3d, 0xaa, 0x64, 0x83, 0xda, 0xb4,
+    0x4c, 0xef, 0x84, 0x8f, 0x86, 0xd6, 0x1a, 0x99, 0x21, 0xaf, 0xcc, 0x51, 0xfe, 0x67, 0xc2, 0x44,
+    0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x74, 0x86, 0xa6, 0x48, 0x6b, 0x44, 0x77,
+    0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xf4, 0x21, 0x22, 0x64, 0x86, 0xa7, 0x48, 0x6b,
+    0x44, 0x77, 0xc2, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0x92, 0x1a, 0x9d,
+    0x21, 0xad, 0x11, 0xe8, 0x42, 0x44, 0xc9, 0x0d, 0x4c, 0x90, 0xd6, 0x88, 0xef, 0x84, 0x89, 0x92,
+    0x1a, 0x99, 0x21, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x9d, 0x21, 0xa9, 0x92, 0x1a, 0xd1, 0x1d, 0xf0,
+    0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xa9, 0xd2, 0x1a, 0xd1,
+    0x1d, 0xf0, 0x91, 0x32, 0x43, 0x53, 0x24, 0x35, 0xa2, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xa9, 0xd2,
+    0x1a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09, 0x13, 0x24,
+    0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x27, 0x48, 0x6a, 0x64, 0x86, 0xb4, 0x47, 0xa1, 0x09,
+    0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x26, 0x48, 0x6a, 0x74, 0x86, 0xb4, 0x47,
+    0xa1, 0x09, 0x13, 0x24, 0x35, 0x32, 0x43, 0x5a, 0x23, 0xbe, 0x12, 0x3e, 0x1c, 0x58, 0x7d, 0xaa,
+    0x64, 0x87, 0xda, 0xbf, 0x30, 0x4c, 0xff, 0x00, 0x33, 0xa1, 0x22, 0x64, 0x87, 0xda, 0xa6, 0x48,
+    0x7d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x27, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xb4, 0x4c, 0xef,
+    0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xf6,
+    0xa9, 0xd2, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xb4,
+    0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa7, 0x48, 0x7d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99,
+    0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21,
+    0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x74, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xcf, 0x42,
+    0x12, 0x26, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1f, 0x6a,
+    0x9d, 0x21, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1,
+    0x33, 0xbe, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x74, 0x87, 0xda, 0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64,
+    0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f,
+    0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0xd2, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3b, 0xe1,
+    0x22, 0x64, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xcf, 0x42, 0x12, 0x27, 0x48, 0x7d, 0xaa,
+    0x64, 0x87, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13,
+    0x3d, 0x08, 0x48, 0xf8, 0x6d, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xfc, 0xc5, 0x33, 0xfc, 0xce,
+    0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x9d, 0x21, 0xf6,
+    0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xb4,
+    0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa7, 0x48, 0x7d, 0xab, 0x44, 0xce, 0xf8, 0x48, 0x99,
+    0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xb4, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x74, 0x87,
+    0xda, 0xb5, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xab, 0x4c, 0xf4, 0x21,
+    0x22, 0x64, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x54, 0xce, 0xf8, 0x48, 0x9d, 0x21, 0xf6, 0xa9,
+    0x92, 0x1f, 0x6a, 0xb4, 0xcf, 0x42, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xb4, 0x4c,
+    0xef, 0x84, 0x89, 0xd2, 0x1f, 0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0x99, 0x21,
+    0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xbe, 0x12, 0x26, 0x48, 0x7d, 0xaa, 0x74, 0x87, 0xda,
+    0xb4, 0x4c, 0xf4, 0x21, 0x22, 0x64, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xce, 0xf8, 0x48,
+    0x99, 0x21, 0xf6, 0xa9, 0x92, 0x1f, 0x6a, 0xd1, 0x33, 0xd0, 0x84, 0x89, 0xd2, 0x1f, 0x6a, 0x99,
+    0x21, 0xf6, 0xad, 0x13, 0x3b, 0xe1, 0x22, 0x64, 0x87, 0xda, 0xa6, 0x48, 0x7d, 0xab, 0x44, 0xcf,
+    0x42, 0x12, 0x27, 0x48, 0x7d, 0xaa, 0x64, 0x87, 0xda, 0xb4, 0x4c, 0xef, 0x84, 0x89, 0x92, 0x1f,
+    0x6a, 0x99, 0x21, 0xf6, 0xad, 0x13, 0x3d, 0x08, 0x48, 0xff, 0xd9,
+};
+const unsigned int jpeg_sample_qvga_len = 6843;
@@ -0,0 +1,743 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <forward_list>
+#include <vector>
+#include "unity.h"
+
+#include "detect.h"
+
+/* a 192x192 YOLOv5 head: 3 anchors over 24x24, 12x12 and 6x6 cells */
+#define RECORDS 2268
+#define INPUT 192
+#define SCALE (1.0f / 256)
+#define ZERO_POINT (-128)
+#define TOP_N 256
+#define MAX_OUT 128
+
+static int8_t quantize(float v)
+{
+    int q = (int)lroundf(v / SCALE) + ZERO_POINT;
+    return (int8_t)(q < -128 ? -128 : (q > 127 ? 127 : q));
+}
+
+/* box and confidence as fractions of the input, like the model gives them */
+static void set_row(int8_t *row, int num_class, float x, float y, float w, float h, float confidence, int target)
+{
+    row[DETECT_X_INDEX] = quantize(x);
+    row[DETECT_Y_INDEX] = quantize(y);
+    row[DETECT_W_INDEX] = quantize(w);
+    row[DETECT_H_INDEX] = quantize(h);
+    row[DETECT_C_INDEX] = quantize(confidence);
+    for (int j = 0; j < num_class; j++)
+    {
+        row[DETECT_T_INDEX + j] = quantize(j == target ? 0.9f : 0.1f);
+    }
+}
+
+/* a crowded frame: every anchor is a jittered copy of one of the objects, most above the threshold */
+static void fill_dense(int8_t *output, int num_class, int objects, unsigned seed)
+{
+    srand(seed);
+    int side = (int)ceilf(sqrtf((float)objects));
+    for (int i = 0; i < RECORDS; i++)
+    {
+        int o = rand() % objects;
+        float cx = (o % side + 0.5f) / side;
+        float cy = (o / side + 0.5f) / side;
+        float jitter = ((rand() % 21) - 10) / 1000.0f;
+        float size = 0.8f / side + ((rand() % 11) - 5) / 1000.0f;
+        set_row(output + i * (num_class + DETECT_T_INDEX), num_class, cx + jitter, cy - jitter, size, size,
+                0.2f + (rand() % 80) / 100.0f, o % num_class);
+    }
+}
+
+static detect_config_t make_config(int num_class, uint8_t threshold = 25, uint8_t iou = 45)
+{
+    detect_config_t config = {};
+    config.num_record = RECORDS;
+    config.num_class = num_class;
+    config.scale = SCALE;
+    config.zero_point = ZERO_POINT;
+    config.width = INPUT;
+    config.height = INPUT;
+    config.threshold = threshold;
+    config.iou = iou;
+    return config;
+}
+
+/* the forward_list decoder detect_yolo() replaced, kept to compare against */
+static uint16_t legacy_overlap(float x1, float w1, float x2, float w2)
+{
+    uint16_t l1 = x1 - w1 / 2;
+    uint16_t l2 = x2 - w2 / 2;
+    uint16_t left = l1 > l2 ? l1 : l2;
+    uint16_t r1 = x1 + w1 / 2;
+    uint16_t r2 = x2 + w2 / 2;
+    uint16_t right = r1 < r2 ? r1 : r2;
+    return right - left;
+}
+
+static void legacy_nms(std::forward_list<detect_box_t> &list, uint8_t nms)
+{
+    list.sort([](const detect_box_t &a, const detect_box_t &b) { return a.confidence > b.confidence; });
+    for (auto it = list.begin(); it != list.end(); ++it)
+    {
+        uint32_t area = uint32_t(it->w) * it->h;
+        for (auto itc = std::next(it, 1); itc != list.end(); ++itc)
+        {
+            if (itc->confidence == 0)
+            {
+                continue;
+            }
+            uint16_t iw = legacy_overlap(itc->x, itc->w, it->x, it->w);
+            if (iw > 0)
+            {
+                uint16_t ih = legacy_overlap(itc->y, itc->h, it->y, it->h);
+                if (ih > 0)
+                {
+                    // unsigned, a 16-bit w * h overflows int on a large frame
+                    uint32_t inter = uint32_t(iw) * ih;
+                    float ua = float(uint32_t(itc->w) * itc->h + area - inter);
+                    float ov = inter / ua;
+                    if (int(float(ov) * 100) >= nms)
+                    {
+                        itc->confidence = 0;
+                    }
+                }
+            }
+        }
+    }
+    list.remove_if([](const detect_box_t &box) { return box.confidence == 0; });
+}
+
+static std::forward_list<detect_box_t> legacy_topn(const int8_t *dataset, uint16_t top_n, const detect_config_t &config)
+{
+    const int num_class = config.num_class;
+    const int num_element = num_class + DETECT_T_INDEX;
+    std::vector<std::forward_list<detect_box_t>> lists(num_class);
+    std::vector<int> num_obj(num_class, 0);
+    for (int i = 0; i < config.num_record; i++)
+    {
+        const int8_t *row = dataset + i * num_element;
+        float confidence = float(row[DETECT_C_INDEX] - config.zero_point) * config.scale * 100;
+        if (int(confidence) < config.threshold)
+        {
+            continue;
+        }
+        detect_box_t obj;
+        int8_t max = -128;
+        obj.target = 0;
+        for (int j = 0; j < num_class; j++)
+        {
+            if (max < row[DETECT_T_INDEX + j])
+            {
+                max = row[DETECT_T_INDEX + j];
+                obj.target = j;
+            }
+        }
+        obj.x = std::min(std::max(int(float(row[DETECT_X_INDEX] - config.zero_point) * config.scale * config.width), 0), int(config.width));
+        obj.y = std::min(std::max(int(float(row[DETECT_Y_INDEX] - config.zero_point) * config.scale * config.height), 0), int(config.height));
+        obj.w = std::min(std::max(int(float(row[DETECT_W_INDEX] - config.zero_point) * config.scale * config.width), 0), int(config.width));
+        obj.h = std::min(std::max(int(float(row[DETECT_H_INDEX] - config.zero_point) * config.scale * config.height), 0), int(config.height));
+        obj.w = (obj.x + obj.w) > config.width ? (config.width - obj.x) : obj.w;
+        obj.h = (obj.y + obj.h) > config.height ? (config.height - obj.y) : obj.h;
+        obj.confidence = confidence;
+        auto &list = lists[obj.target];
+        if (num_obj[obj.target] >= top_n)
+        {
+            list.sort([](const detect_box_t &a, const detect_box_t &b) { return a.confidence < b.confidence; });
+            if (obj.confidence > list.front().confidence)
+            {
+                list.pop_front();
+                list.emplace_front(obj);
+            }
+        }
+        else
+        {
+            list.emplace_front(obj);
+            num_obj[obj.target]++;
+        }
+    }
+    std::forward_list<detect_box_t> result;
+    for (int i = 0; i < num_class; i++)
+    {
+        legacy_nms(lists[i], config.iou);
+        result.splice_after(result.before_begin(), lists[i]);
+    }
+    result.sort([](const detect_box_t &a, const detect_box_t &b) { return a.x > b.x; });
+    return result;
+}
+
+struct Workspace
+{
+    detect_workspace_t ws;
+    void *buffer;
+
+    Workspace(uint16_t num_class, uint16_t top_n)
+    {
+        size_t size = detect_workspace_size(num_class, top_n);
+        buffer = malloc(size);
+        TEST_ASSERT_EQUAL(0, detect_workspace_init(&ws, buffer, size, num_class, top_n));
+    }
+    ~Workspace()
+    {
+        free(buffer);
+    }
+};
+
+TEST_CASE("detect decodes rows above the threshold into input pixels", "[detect]")
+{
+    const int num_class = 3;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    memset(output, ZERO_POINT, sizeof(output));
+    set_row(output, num_class, 0.25f, 0.5f, 0.1f, 0.2f, 0.9f, 2);
+    set_row(output + 7 * (num_class + DETECT_T_INDEX), num_class, 0.75f, 0.5f, 0.1f, 0.1f, 0.2f, 1); // below 25%
+    set_row(output + 9 * (num_class + DETECT_T_INDEX), num_class, 0.98f, 0.02f, 0.2f, 0.1f, 0.5f, 0);
+
+    Workspace w(num_class, TOP_N);
+    detect_config_t config = make_config(num_class);
+    detect_box_t out[MAX_OUT];
+    int found = -1;
+    TEST_ASSERT_EQUAL(2, detect_yolo(output, &config, &w.ws, out, MAX_OUT, &found));
+    TEST_ASSERT_EQUAL(2, found);
+
+    // right to left
+    TEST_ASSERT_EQUAL(188, out[0].x);
+    TEST_ASSERT_EQUAL(3, out[0].y);
+    TEST_ASSERT_EQUAL(4, out[0].w); // cut at the right edge like before
+    TEST_ASSERT_EQUAL(0, out[0].target);
+    TEST_ASSERT_EQUAL(50, out[0].confidence);
+    TEST_ASSERT_EQUAL(48, out[1].x);
+    TEST_ASSERT_EQUAL(96, out[1].y);
+    TEST_ASSERT_EQUAL(19, out[1].w);
+    TEST_ASSERT_EQUAL(38, out[1].h);
+    TEST_ASSERT_EQUAL(2, out[1].target);
+    TEST_ASSERT_EQUAL(89, out[1].confidence);
+
+    // a workspace made for fewer classes is refused
+    Workspace small(num_class - 1, TOP_N);
+    TEST_ASSERT_EQUAL(-1, detect_yolo(output, &config, &small.ws, out, MAX_OUT, &found));
+}
+
+TEST_CASE("detect suppresses overlaps within a class only", "[detect]")
+{
+    const int num_class = 2;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    memset(output, ZERO_POINT, sizeof(output));
+    int8_t *row = output;
+    const int stride = num_class + DETECT_T_INDEX;
+    set_row(row, num_class, 0.5f, 0.5f, 0.2f, 0.2f, 0.6f, 0);
+    set_row(row += stride, num_class, 0.51f, 0.5f, 0.2f, 0.2f, 0.8f, 0); // wins over the first
+    set_row(row += stride, num_class, 0.5f, 0.51f, 0.2f, 0.2f, 0.7f, 1); // same place, other class
+    set_row(row += stride, num_class, 0.62f, 0.5f, 0.2f, 0.2f, 0.5f, 0); // a third off, kept
+    // far apart: the old uint16_t overlap wrapped around for these
+    set_row(row += stride, num_class, 0.05f, 0.05f, 0.08f, 0.08f, 0.9f, 0);
+    set_row(row += stride, num_class, 0.95f, 0.95f, 0.08f, 0.08f, 0.4f, 0);
+
+    Workspace w(num_class, TOP_N);
+    detect_config_t config = make_config(num_class);
+    detect_box_t out[MAX_OUT];
+    int found = 0;
+    TEST_ASSERT_EQUAL(5, detect_yolo(output, &config, &w.ws, out, MAX_OUT, &found));
+    TEST_ASSERT_EQUAL(5, found);
+
+    uint8_t expect[] = {39, 50, 80, 69, 89};
+    for (int i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_EQUAL(expect[i], out[i].confidence);
+    }
+    TEST_ASSERT_EQUAL(1, out[3].target);
+
+    // the most confident are the ones that stay when out is short
+    TEST_ASSERT_EQUAL(2, detect_yolo(output, &config, &w.ws, out, 2, &found));
+    TEST_ASSERT_EQUAL(5, found);
+    TEST_ASSERT_EQUAL(80, out[0].confidence);
+    TEST_ASSERT_EQUAL(89, out[1].confidence);
+}
+
+TEST_CASE("detect keeps the top n of each class whatever the row order", "[detect]")
+{
+    const int num_class = 2;
+    const int stride = num_class + DETECT_T_INDEX;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    static int8_t shuffled[RECORDS * (num_class + DETECT_T_INDEX)];
+    fill_dense(output, num_class, 60, 1);
+
+    // the reference: no bound on the candidates, the same greedy NMS
+    Workspace all(num_class, RECORDS);
+    detect_config_t config = make_config(num_class);
+    detect_box_t expect[MAX_OUT], out[MAX_OUT];
+    int expect_found = 0, found = 0;
+    int n = detect_yolo(output, &config, &all.ws, expect, MAX_OUT, &expect_found);
+    TEST_ASSERT_TRUE(n > 0);
+
+    // row order makes no difference
+    memcpy(shuffled, output, sizeof(output));
+    srand(7);
+    for (int i = RECORDS - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1);
+        int8_t t[stride];
+        memcpy(t, shuffled + i * stride, stride);
+        memcpy(shuffled + i * stride, shuffled + j * stride, stride);
+        memcpy(shuffled + j * stride, t, stride);
+    }
+    TEST_ASSERT_EQUAL(n, detect_yolo(shuffled, &config, &all.ws, out, MAX_OUT, &found));
+    TEST_ASSERT_EQUAL(expect_found, found);
+    TEST_ASSERT_EQUAL_MEMORY(expect, out, n * sizeof(detect_box_t));
+
+    // a single candidate per class: the most confident box of each
+    Workspace one(num_class, 1);
+    TEST_ASSERT_EQUAL(2, detect_yolo(shuffled, &config, &one.ws, out, MAX_OUT, &found));
+    for (int i = 0; i < 2; i++)
+    {
+        uint8_t best = 0;
+        for (int r = 0; r < RECORDS; r++)
+        {
+            const int8_t *row = output + r * stride;
+            if (row[DETECT_T_INDEX + out[i].target] > row[DETECT_T_INDEX + 1 - out[i].target])
+            {
+                best = std::max(best, uint8_t(float(row[DETECT_C_INDEX] - ZERO_POINT) * SCALE * 100));
+            }
+        }
+        TEST_ASSERT_EQUAL(best, out[i].confidence);
+    }
+}
+
+TEST_CASE("detect matches the list decoder on separate objects", "[detect]")
+{
+    const int num_class = 3;
+    const int stride = num_class + DETECT_T_INDEX;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    memset(output, ZERO_POINT, sizeof(output));
+    // a few objects far from each other, each seen by several anchors
+    for (int o = 0; o < 9; o++)
+    {
+        for (int a = 0; a < 6; a++)
+        {
+            set_row(output + (o * 200 + a * 31) * stride, num_class, 0.15f + (o % 3) * 0.33f + a * 0.004f,
+                    0.15f + (o / 3) * 0.33f, 0.2f, 0.2f - a * 0.005f, 0.3f + o * 0.05f + a * 0.02f, o % num_class);
+        }
+    }
+
+    Workspace w(num_class, TOP_N);
+    detect_config_t config = make_config(num_class);
+    detect_box_t out[MAX_OUT];
+    int n = detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL);
+    std::forward_list<detect_box_t> expect = legacy_topn(output, RECORDS, config);
+
+    TEST_ASSERT_EQUAL(9, n);
+    TEST_ASSERT_EQUAL(n, std::distance(expect.begin(), expect.end()));
+    int i = 0;
+    for (auto &box : expect)
+    {
+        TEST_ASSERT_EQUAL_MEMORY(&box, &out[i++], sizeof(detect_box_t));
+    }
+}
+
+TEST_CASE("detect quantized decode keeps the rows of the float decode", "[detect]")
+{
+    const int num_class = 2;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    srand(11);
+    for (size_t i = 0; i < sizeof(output); i++)
+    {
+        output[i] = (int8_t)(rand() & 0xFF);
+    }
+
+    // fractions and %, pixels and %; thresholds from all rows to none
+    const struct
+    {
+        float scale;
+        int zero_point;
+    } quant[] = {{SCALE, ZERO_POINT}, {0.0072f, -97}, {0.6f, -20}};
+    const uint8_t thresholds[] = {0, 1, 25, 63, 99, 100, 255};
+    Workspace w(num_class, RECORDS);
+    static detect_box_t expect[RECORDS], out[RECORDS];
+    for (auto &q : quant)
+    {
+        for (uint8_t threshold : thresholds)
+        {
+            detect_config_t config = make_config(num_class, threshold);
+            config.num_record = RECORDS - 3; // a partial block of 8 at the end
+            config.scale = q.scale;
+            config.zero_point = q.zero_point;
+            int expect_found = 0, found = 0;
+            int n = detect_yolo(output, &config, &w.ws, expect, RECORDS, &expect_found);
+
+            detect_prepare(&config);
+            TEST_ASSERT_EQUAL(DETECT_DECODE_QUANTIZED, config.decode);
+            TEST_ASSERT_EQUAL(n, detect_yolo(output, &config, &w.ws, out, RECORDS, &found));
+            TEST_ASSERT_EQUAL(expect_found, found);
+            TEST_ASSERT_EQUAL_MEMORY(expect, out, n * sizeof(detect_box_t));
+        }
+    }
+
+    // the bar sits exactly where the float compare starts to pass
+    detect_config_t config = make_config(num_class);
+    detect_prepare(&config);
+    TEST_ASSERT_EQUAL(-128 + 64, config.threshold_q); // 64 / 256 is 25%
+    config.threshold = 101;
+    detect_prepare(&config);
+    TEST_ASSERT_EQUAL(128, config.threshold_q);
+}
+
+TEST_CASE("detect binned NMS keeps the boxes of comparing every pair", "[detect]")
+{
+    const int classes[] = {1, 3};
+    const uint8_t ious[] = {0, 20, 45, 80, 100};
+    static int8_t output[RECORDS * (3 + DETECT_T_INDEX)];
+    static detect_box_t expect[RECORDS], out[RECORDS];
+    for (int num_class : classes)
+    {
+        Workspace w(num_class, 512);
+        for (unsigned seed = 0; seed < 6; seed++)
+        {
+            // crowds of every density, then boxes of any size anywhere
+            if (seed < 5)
+            {
+                fill_dense(output, num_class, 5 + seed * 40, seed);
+            }
+            else
+            {
+                for (size_t i = 0; i < sizeof(output); i++)
+                {
+                    output[i] = (int8_t)(rand() & 0xFF);
+                }
+            }
+            for (uint8_t iou : ious)
+            {
+                for (int agnostic = 0; agnostic <= 1; agnostic++)
+                {
+                    detect_config_t config = make_config(num_class, 25, iou);
+                    config.agnostic = agnostic;
+                    int expect_found = 0, found = 0;
+                    int n = detect_yolo(output, &config, &w.ws, expect, RECORDS, &expect_found);
+                    config.binned = true;
+                    TEST_ASSERT_EQUAL(n, detect_yolo(output, &config, &w.ws, out, RECORDS, &found));
+                    TEST_ASSERT_EQUAL(expect_found, found);
+                    TEST_ASSERT_EQUAL_MEMORY(expect, out, n * sizeof(detect_box_t));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("detect agnostic NMS suppresses across classes", "[detect]")
+{
+    const int num_class = 2;
+    const int stride = num_class + DETECT_T_INDEX;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    memset(output, ZERO_POINT, sizeof(output));
+    set_row(output, num_class, 0.5f, 0.5f, 0.2f, 0.2f, 0.6f, 0);
+    set_row(output + stride, num_class, 0.51f, 0.5f, 0.2f, 0.2f, 0.8f, 1);
+    set_row(output + 2 * stride, num_class, 0.2f, 0.2f, 0.2f, 0.2f, 0.5f, 0);
+
+    Workspace w(num_class, TOP_N);
+    detect_box_t out[MAX_OUT];
+    for (int binned = 0; binned <= 1; binned++)
+    {
+        detect_config_t config = make_config(num_class);
+        config.binned = binned;
+        TEST_ASSERT_EQUAL(3, detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL));
+        config.agnostic = true;
+        TEST_ASSERT_EQUAL(2, detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL));
+        TEST_ASSERT_EQUAL(1, out[0].target);
+        TEST_ASSERT_EQUAL(80, out[0].confidence);
+        TEST_ASSERT_EQUAL(0, out[1].target);
+    }
+}
+
+static detect_box_t make_box(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t confidence = 50)
+{
+    detect_box_t box = {x, y, w, h, confidence, 0};
+    return box;
+}
+
+/* intersection and union the straightforward way, in doubles that hold the half pixels exactly */
+static void ref_overlap(const detect_box_t &a, const detect_box_t &b, double *inter, double *uni)
+{
+    double iw = std::min(a.x + a.w / 2.0, b.x + b.w / 2.0) - std::max(a.x - a.w / 2.0, b.x - b.w / 2.0);
+    double ih = std::min(a.y + a.h / 2.0, b.y + b.h / 2.0) - std::max(a.y - a.h / 2.0, b.y - b.h / 2.0);
+    *inter = iw > 0 && ih > 0 ? iw * ih : 0;
+    *uni = double(a.w) * a.h + double(b.w) * b.h - *inter;
+}
+
+TEST_CASE("detect integer IoU agrees with the float one", "[detect]")
+{
+    srand(13);
+    for (int i = 0; i < 20000; i++)
+    {
+        detect_box_t a = make_box(rand() % 200, rand() % 200, 1 + rand() % 120, 1 + rand() % 120);
+        detect_box_t b = make_box(rand() % 200, rand() % 200, 1 + rand() % 120, 1 + rand() % 120);
+        if (i % 4 == 0)
+        {
+            // near copies, where the thresholds matter
+            b = make_box(a.x + rand() % 7, a.y + rand() % 7, std::max(1, a.w - rand() % 9), std::max(1, a.h - rand() % 9));
+        }
+        double inter, uni;
+        ref_overlap(a, b, &inter, &uni);
+        for (int t = 0; t <= 100; t += 5)
+        {
+            TEST_ASSERT_EQUAL(inter > 0 && inter * 100 >= t * uni, detect_iou_at_least(&a, &b, t));
+        }
+        TEST_ASSERT_INT_WITHIN(1, int(inter / uni * 32768), detect_iou_q15(&a, &b));
+    }
+
+    // the old uint16_t overlap wrapped around for boxes apart and past the left edge
+    detect_box_t left = make_box(5, 50, 40, 40);
+    detect_box_t apart = make_box(150, 50, 20, 20);
+    TEST_ASSERT_FALSE(detect_iou_at_least(&left, &apart, 0));
+    TEST_ASSERT_EQUAL(0, detect_iou_q15(&left, &apart));
+    detect_box_t inside = make_box(10, 50, 20, 40);
+    TEST_ASSERT_EQUAL(32768 * 20 * 40 / (40 * 40), detect_iou_q15(&left, &inside));
+    TEST_ASSERT_TRUE(detect_iou_at_least(&left, &inside, 50));
+    TEST_ASSERT_FALSE(detect_iou_at_least(&left, &inside, 51));
+}
+
+TEST_CASE("detect fixed point exp follows expf", "[detect]")
+{
+    for (uint32_t x = 0; x < 9 << 15; x += 97)
+    {
+        // linear between eighths, off by 0.2% at most
+        int expect = x >= 8 << 15 ? 0 : int(expf(-float(x) / 32768) * 32768);
+        TEST_ASSERT_INT_WITHIN(70, expect, detect_exp_neg_q15(x));
+    }
+}
+
+/* soft-NMS in doubles over decoded boxes, kept ones in the order they are taken */
+static std::vector<detect_box_t> ref_soft_nms(std::vector<detect_box_t> boxes, detect_nms_t nms, double iou, double sigma, int threshold)
+{
+    std::vector<double> scores;
+    for (auto &box : boxes)
+    {
+        scores.push_back(box.confidence);
+    }
+    std::vector<detect_box_t> kept;
+    while (!boxes.empty())
+    {
+        size_t best = std::max_element(scores.begin(), scores.end()) - scores.begin();
+        if (scores[best] < threshold)
+        {
+            break;
+        }
+        detect_box_t box = boxes[best];
+        box.confidence = uint8_t(scores[best]);
+        kept.push_back(box);
+        boxes.erase(boxes.begin() + best);
+        scores.erase(scores.begin() + best);
+        for (size_t j = 0; j < boxes.size(); j++)
+        {
+            double inter, uni;
+            ref_overlap(box, boxes[j], &inter, &uni);
+            double o = inter / uni;
+            if (nms == DETECT_NMS_LINEAR)
+            {
+                scores[j] *= o >= iou ? 1 - o : 1;
+            }
+            else
+            {
+                scores[j] *= exp(-o * o / sigma);
+            }
+        }
+    }
+    return kept;
+}
+
+TEST_CASE("detect soft NMS decays overlapping boxes instead of dropping them", "[detect]")
+{
+    const int num_class = 1;
+    const int stride = num_class + DETECT_T_INDEX;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    memset(output, ZERO_POINT, sizeof(output));
+    // two people side by side, half of each box on the other, and one a bit further
+    set_row(output, num_class, 0.40f, 0.5f, 0.2f, 0.4f, 0.8f, 0);
+    set_row(output + stride, num_class, 0.47f, 0.5f, 0.2f, 0.4f, 0.6f, 0);
+    set_row(output + 2 * stride, num_class, 0.58f, 0.5f, 0.2f, 0.4f, 0.5f, 0);
+
+    Workspace w(num_class, TOP_N);
+    detect_box_t out[MAX_OUT];
+    detect_config_t config = make_config(num_class, 25, 30);
+    TEST_ASSERT_EQUAL(2, detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL));
+
+    // all three as decoded, most confident first
+    config.iou = 100;
+    TEST_ASSERT_EQUAL(3, detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL));
+    std::vector<detect_box_t> boxes(out, out + 3);
+    std::reverse(boxes.begin(), boxes.end());
+    config.iou = 30;
+
+    const detect_nms_t modes[] = {DETECT_NMS_LINEAR, DETECT_NMS_GAUSSIAN};
+    const uint8_t thresholds[] = {25, 45};
+    for (detect_nms_t nms : modes)
+    {
+        for (uint8_t threshold : thresholds)
+        {
+            config.nms = nms;
+            config.sigma = 50;
+            config.threshold = threshold;
+            std::vector<detect_box_t> expect = ref_soft_nms(boxes, nms, 0.3, 0.5, threshold);
+            std::sort(expect.begin(), expect.end(), [](const detect_box_t &a, const detect_box_t &b) { return a.x > b.x; });
+            TEST_ASSERT_EQUAL(expect.size(), detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL));
+            for (size_t i = 0; i < expect.size(); i++)
+            {
+                TEST_ASSERT_EQUAL(expect[i].x, out[i].x);
+                TEST_ASSERT_INT_WITHIN(1, expect[i].confidence, out[i].confidence);
+            }
+        }
+    }
+
+    // the one hard NMS drops is still there, with less confidence
+    config.nms = DETECT_NMS_LINEAR;
+    config.threshold = 25;
+    TEST_ASSERT_EQUAL(3, detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL));
+    TEST_ASSERT_EQUAL(50, out[0].confidence);
+    TEST_ASSERT_TRUE(out[1].confidence < 59);
+    TEST_ASSERT_EQUAL(80, out[2].confidence);
+}
+
+TEST_CASE("detect throughput on dense outputs", "[detect][performance]")
+{
+    const int rounds = 20;
+    const int classes[] = {1, 3};
+    for (int c = 0; c < 2; c++)
+    {
+        const int num_class = classes[c];
+        int8_t *output = (int8_t *)malloc(RECORDS * (num_class + DETECT_T_INDEX));
+        TEST_ASSERT_NOT_NULL(output);
+        fill_dense(output, num_class, 100, 3);
+        detect_config_t config = make_config(num_class);
+        Workspace w(num_class, TOP_N);
+        detect_box_t out[MAX_OUT];
+        int found = 0, n = 0;
+        size_t legacy_n = 0;
+
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            n = detect_yolo(output, &config, &w.ws, out, MAX_OUT, &found);
+        }
+        clock_t mid = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            auto list = legacy_topn(output, RECORDS, config);
+            legacy_n = std::distance(list.begin(), list.end());
+        }
+        clock_t capped = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            legacy_topn(output, TOP_N, config);
+        }
+        clock_t end = clock();
+
+        TEST_ASSERT_TRUE(n > 0);
+        printf("%d records, %d classes, 100 objects: %d found (list %u): heap %.3f ms/frame, list %.3f ms/frame, list top %d %.3f ms/frame\n",
+               RECORDS, num_class, found, (unsigned)legacy_n, (mid - start) * 1000.0 / CLOCKS_PER_SEC / rounds,
+               (capped - mid) * 1000.0 / CLOCKS_PER_SEC / rounds, TOP_N, (end - capped) * 1000.0 / CLOCKS_PER_SEC / rounds);
+        free(output);
+    }
+}
+
+TEST_CASE("detect objectness scan throughput", "[detect][performance]")
+{
+    const int rounds = 200;
+    const int num_class = 1;
+    const int stride = num_class + DETECT_T_INDEX;
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    // a usual frame: background anchors under 10%, a handful of objects
+    srand(5);
+    for (int i = 0; i < RECORDS; i++)
+    {
+        set_row(output + i * stride, num_class, (rand() % 100) / 100.0f, (rand() % 100) / 100.0f, 0.1f, 0.1f, (rand() % 10) / 100.0f, 0);
+    }
+    for (int o = 0; o < 5; o++)
+    {
+        for (int a = 0; a < 6; a++)
+        {
+            set_row(output + (o * 400 + a * 17) * stride, num_class, 0.1f + o * 0.2f, 0.5f, 0.15f, 0.15f, 0.5f + a * 0.05f, 0);
+        }
+    }
+
+    Workspace w(num_class, TOP_N);
+    detect_box_t out[MAX_OUT];
+    double ms[2];
+    int n[2];
+    for (int mode = 0; mode < 2; mode++)
+    {
+        detect_config_t config = make_config(num_class);
+        if (mode)
+        {
+            detect_prepare(&config);
+        }
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            n[mode] = detect_yolo(output, &config, &w.ws, out, MAX_OUT, NULL);
+        }
+        ms[mode] = (clock() - start) * 1000.0 / CLOCKS_PER_SEC / rounds;
+    }
+    TEST_ASSERT_EQUAL(5, n[0]);
+    TEST_ASSERT_EQUAL(n[0], n[1]);
+    printf("%d records, 5 objects: float decode %.4f ms/frame, quantized decode %.4f ms/frame\n", RECORDS, ms[0], ms[1]);
+}
+
+TEST_CASE("detect binned NMS throughput", "[detect][performance]")
+{
+    const int rounds = 20;
+    const int num_class = 1;
+    const int counts[] = {50, 100};
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    // every candidate through NMS: the worst case of a crowded frame
+    Workspace w(num_class, RECORDS);
+    detect_box_t out[MAX_OUT];
+    for (int objects : counts)
+    {
+        fill_dense(output, num_class, objects, 9);
+        double ms[2];
+        int found[2];
+        for (int binned = 0; binned <= 1; binned++)
+        {
+            detect_config_t config = make_config(num_class);
+            config.binned = binned;
+            detect_prepare(&config);
+            clock_t start = clock();
+            for (int r = 0; r < rounds; r++)
+            {
+                detect_yolo(output, &config, &w.ws, out, MAX_OUT, &found[binned]);
+            }
+            ms[binned] = (clock() - start) * 1000.0 / CLOCKS_PER_SEC / rounds;
+        }
+        TEST_ASSERT_EQUAL(found[0], found[1]);
+        printf("%d records, %d objects, %d found: every pair %.3f ms/frame, binned %.3f ms/frame\n", RECORDS, objects, found[0], ms[0], ms[1]);
+    }
+}
+
+TEST_CASE("detect soft NMS throughput", "[detect][performance]")
+{
+    const int rounds = 20;
+    const int num_class = 1;
+    static const char *names[] = {"hard", "linear", "gaussian"};
+    static int8_t output[RECORDS * (num_class + DETECT_T_INDEX)];
+    fill_dense(output, num_class, 100, 9);
+    Workspace w(num_class, TOP_N);
+    detect_box_t out[MAX_OUT];
+    for (int nms = DETECT_NMS_HARD; nms <= DETECT_NMS_GAUSSIAN; nms++)
+    {
+        detect_config_t config = make_config(num_class);
+        config.nms = (detect_nms_t)nms;
+        config.sigma = 50;
+        detect_prepare(&config);
+        int found = 0;
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            detect_yolo(output, &config, &w.ws, out, MAX_OUT, &found);
+        }
+        printf("%d records, 100 objects, top %d, %s NMS: %d found, %.3f ms/frame\n", RECORDS, TOP_N, names[nms], found,
+               (clock() - start) * 1000.0 / CLOCKS_PER_SEC / rounds);
+    }
+}
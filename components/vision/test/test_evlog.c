@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "evlog.h"
+
+typedef struct
+{
+    char text[512];
+    size_t lines;
+} capture_t;
+
+static int capture(const char *line, void *ctx)
+{
+    capture_t *c = (capture_t *)ctx;
+    size_t len = strlen(c->text);
+    snprintf(c->text + len, sizeof(c->text) - len, "%s", line);
+    c->lines++;
+    return 0;
+}
+
+TEST_CASE("evlog formats records in order", "[evlog]")
+{
+    evlog_t log = {0};
+    capture_t out = {{0}, 0};
+    TEST_ASSERT_EQUAL(0, evlog_init(&log, 8));
+
+    EVLOG(&log, "Predictions (DSP: %d ms., Classification: %d ms., Anomaly: %d ms.): \n", EVLOG_I(3), EVLOG_I(-12), EVLOG_I(0));
+    EVLOG(&log, "    %s (%f) [ x: %u, y: %u ]\n", EVLOG_S("meter"), EVLOG_F(0.5f), EVLOG_I(120), EVLOG_I(7));
+    EVLOG(&log, "%04x %5.2f%% %-3c|\n", EVLOG_I(0xbe), EVLOG_F(12.345f), EVLOG_I('z'));
+    // a tracked object, EVLOG_MAX_ARGS values on one line
+    EVLOG(&log, "{\"class\": \"%d\", \"x\": %d, \"y\": %d, \"w\": %d, \"h\": %d, \"confidence\": %d, \"id\": %d},\n",
+          EVLOG_I(1), EVLOG_I(2), EVLOG_I(3), EVLOG_I(4), EVLOG_I(5), EVLOG_I(6), EVLOG_I(7));
+    EVLOG(&log, "End output\n");
+    TEST_ASSERT_EQUAL(5, evlog_pending(&log));
+
+    TEST_ASSERT_EQUAL(5, evlog_drain(&log, 16, capture, &out));
+    TEST_ASSERT_EQUAL_STRING("Predictions (DSP: 3 ms., Classification: -12 ms., Anomaly: 0 ms.): \n"
+                             "    meter (0.500000) [ x: 120, y: 7 ]\n"
+                             "00be 12.35% z  |\n"
+                             "{\"class\": \"1\", \"x\": 2, \"y\": 3, \"w\": 4, \"h\": 5, \"confidence\": 6, \"id\": 7},\n"
+                             "End output\n",
+                             out.text);
+    TEST_ASSERT_EQUAL(0, evlog_pending(&log));
+    evlog_release(&log);
+}
+
+TEST_CASE("evlog drops records when full and reports them", "[evlog]")
+{
+    evlog_t log = {0};
+    capture_t out = {{0}, 0};
+    TEST_ASSERT_EQUAL(0, evlog_init(&log, 3)); // rounded up to 4
+
+    for (int i = 0; i < 10; i++)
+    {
+        const intptr_t args[] = {i};
+        TEST_ASSERT_EQUAL(i < 4, evlog_write(&log, "%d\n", 1, args));
+    }
+
+    // a partial drain makes room again, the index wraps around the ring
+    TEST_ASSERT_EQUAL(2, evlog_drain(&log, 2, capture, &out));
+    TEST_ASSERT_EQUAL_STRING("evlog: 6 records dropped\n0\n1\n", out.text);
+    EVLOG(&log, "%d\n", EVLOG_I(10));
+    EVLOG(&log, "%d\n", EVLOG_I(11));
+    EVLOG(&log, "%d\n", EVLOG_I(12));
+
+    out.text[0] = '\0';
+    TEST_ASSERT_EQUAL(4, evlog_drain(&log, 16, capture, &out));
+    TEST_ASSERT_EQUAL_STRING("evlog: 1 records dropped\n2\n3\n10\n11\n", out.text);
+    TEST_ASSERT_EQUAL(7, log.dropped);
+    evlog_release(&log);
+}
+
+typedef struct
+{
+    evlog_t *log;
+    uint32_t records;
+    SemaphoreHandle_t done;
+} producer_t;
+
+static void producer_task(void *arg)
+{
+    producer_t *p = (producer_t *)arg;
+    for (uint32_t i = 0; i < p->records; i++)
+    {
+        EVLOG(p->log, "%u %u\n", EVLOG_I(i), EVLOG_I(i * 7));
+        if (i % 256 == 255)
+        {
+            vTaskDelay(1);
+        }
+    }
+    xSemaphoreGive(p->done);
+    vTaskDelete(NULL);
+}
+
+typedef struct
+{
+    uint32_t next;
+    uint32_t received;
+    uint32_t dropped;
+    bool ok;
+} checker_t;
+
+static int check_line(const char *line, void *ctx)
+{
+    checker_t *c = (checker_t *)ctx;
+    unsigned a, b;
+    if (sscanf(line, "evlog: %u records dropped", &a) == 1)
+    {
+        c->dropped += a;
+        return 0;
+    }
+    // every record arrives whole and in order, some may be missing
+    if (sscanf(line, "%u %u", &a, &b) != 2 || a < c->next || b != a * 7)
+    {
+        c->ok = false;
+    }
+    c->next = a + 1;
+    c->received++;
+    return 0;
+}
+
+TEST_CASE("evlog hands records from one task to another without locks", "[evlog]")
+{
+    evlog_t log = {0};
+    checker_t checker = {0, 0, 0, true};
+    producer_t producer = {&log, 20000, xSemaphoreCreateBinary()};
+    TEST_ASSERT_EQUAL(0, evlog_init(&log, 64));
+
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreatePinnedToCore(producer_task, "producer", 4 * 1024, &producer, 5, NULL,
+                                                      portNUM_PROCESSORS - 1));
+    while (xSemaphoreTake(producer.done, 0) != pdTRUE)
+    {
+        evlog_drain(&log, 16, check_line, &checker);
+    }
+    while (evlog_drain(&log, 16, check_line, &checker))
+    {
+    }
+    evlog_drain(&log, 16, check_line, &checker);
+
+    TEST_ASSERT_TRUE(checker.ok);
+    TEST_ASSERT_EQUAL(producer.records, checker.received + checker.dropped);
+    TEST_ASSERT_EQUAL(log.dropped, checker.dropped);
+    printf("evlog: %u of %u records dropped\n", (unsigned)checker.dropped, (unsigned)producer.records);
+
+    vSemaphoreDelete(producer.done);
+    evlog_release(&log);
+}
@@ -0,0 +1,95 @@
+#include <string.h>
+#include "unity.h"
+
+#include "gate.h"
+
+#define THUMB_W 32
+#define THUMB_H 24
+
+static void fill(frame_gate_t *gate, uint8_t value)
+{
+    memset(frame_gate_thumbnail(gate), value, THUMB_W * THUMB_H);
+}
+
+TEST_CASE("gate lets the first frame and changed frames through", "[gate]")
+{
+    frame_gate_t gate;
+    TEST_ASSERT_EQUAL(0, frame_gate_init(&gate, THUMB_W, THUMB_H, 10, 1, 100));
+
+    fill(&gate, 100);
+    TEST_ASSERT_TRUE(frame_gate_check(&gate));
+
+    // noise below the threshold everywhere
+    fill(&gate, 108);
+    TEST_ASSERT_FALSE(frame_gate_check(&gate));
+
+    // 1% of 768 pixels is 7, six are not enough
+    fill(&gate, 100);
+    memset(frame_gate_thumbnail(&gate), 200, 6);
+    TEST_ASSERT_FALSE(frame_gate_check(&gate));
+    fill(&gate, 100);
+    memset(frame_gate_thumbnail(&gate) + 100, 0, 7);
+    TEST_ASSERT_TRUE(frame_gate_check(&gate));
+
+    // the changed frame is the reference now
+    fill(&gate, 100);
+    memset(frame_gate_thumbnail(&gate) + 100, 0, 7);
+    TEST_ASSERT_FALSE(frame_gate_check(&gate));
+
+    TEST_ASSERT_EQUAL(5, gate.frames);
+    TEST_ASSERT_EQUAL(3, gate.skipped);
+    frame_gate_release(&gate);
+}
+
+TEST_CASE("gate compares with the last frame let through", "[gate]")
+{
+    frame_gate_t gate;
+    TEST_ASSERT_EQUAL(0, frame_gate_init(&gate, THUMB_W, THUMB_H, 10, 0, 1000));
+
+    fill(&gate, 50);
+    TEST_ASSERT_TRUE(frame_gate_check(&gate));
+
+    // a slow drift, under the threshold from one frame to the next, adds up
+    int passed = 0;
+    for (int i = 1; i <= 20 && !passed; i++)
+    {
+        fill(&gate, 50 + i * 3);
+        passed = frame_gate_check(&gate) ? i : 0;
+    }
+    TEST_ASSERT_EQUAL(4, passed);
+    frame_gate_release(&gate);
+}
+
+TEST_CASE("gate runs the model after max_skip frames and on reset", "[gate]")
+{
+    frame_gate_t gate;
+    TEST_ASSERT_EQUAL(0, frame_gate_init(&gate, THUMB_W, THUMB_H, 10, 1, 3));
+
+    fill(&gate, 10);
+    TEST_ASSERT_TRUE(frame_gate_check(&gate));
+    for (int round = 0; round < 2; round++)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            fill(&gate, 10);
+            TEST_ASSERT_FALSE(frame_gate_check(&gate));
+        }
+        fill(&gate, 10);
+        TEST_ASSERT_TRUE(frame_gate_check(&gate));
+    }
+
+    fill(&gate, 10);
+    frame_gate_reset(&gate);
+    TEST_ASSERT_TRUE(frame_gate_check(&gate));
+
+    // max_skip 0 never skips
+    frame_gate_release(&gate);
+    TEST_ASSERT_EQUAL(0, frame_gate_init(&gate, THUMB_W, THUMB_H, 10, 1, 0));
+    for (int i = 0; i < 3; i++)
+    {
+        fill(&gate, 10);
+        TEST_ASSERT_TRUE(frame_gate_check(&gate));
+    }
+    TEST_ASSERT_EQUAL(0, gate.skipped);
+    frame_gate_release(&gate);
+}
@@ -0,0 +1,687 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "unity.h"
+
+#include "isp.h"
+
+#define SRC_H 240
+#define SRC_W 320
+#define DST_H 96
+#define DST_W 96
+
+/* smooth gradients with some texture, so the filters have something to average */
+static void fill_rgb565(uint8_t *buf, int h, int w)
+{
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            uint8_t r = (x * 31 / w + ((x ^ y) & 3)) & 0x1F;
+            uint8_t g = (y * 63 / h + ((x * y) & 7)) & 0x3F;
+            uint8_t b = ((x + y) * 31 / (w + h) + (x & 1)) & 0x1F;
+            buf[(y * w + x) * 2] = (r << 3) | (g >> 3);
+            buf[(y * w + x) * 2 + 1] = ((g & 0x07) << 5) | b;
+        }
+    }
+}
+
+static void fill_yuv422p(uint8_t *buf, int h, int w)
+{
+    for (int i = 0; i < h * w; i++)
+    {
+        buf[i] = (i % w) * 255 / w ^ ((i / w) & 15);
+    }
+    for (int i = 0; i < h * w; i++)
+    {
+        buf[h * w + i] = 96 + (i % 64);
+    }
+}
+
+/* float bilinear with the same pixel-centre convention as the ISP */
+static void ref_bilinear(float *dst, const uint8_t *src, int h, int w, int th, int tw, int c)
+{
+    for (int i = 0; i < th; i++)
+    {
+        float fy = (i + 0.5f) * h / th - 0.5f;
+        fy = fy < 0 ? 0 : fy;
+        int y0 = (int)fy;
+        int y1 = y0 + 1 < h ? y0 + 1 : y0;
+        float ay = y0 + 1 < h ? fy - y0 : 0;
+        for (int j = 0; j < tw; j++)
+        {
+            float fx = (j + 0.5f) * w / tw - 0.5f;
+            fx = fx < 0 ? 0 : fx;
+            int x0 = (int)fx;
+            int x1 = x0 + 1 < w ? x0 + 1 : x0;
+            float ax = x0 + 1 < w ? fx - x0 : 0;
+            for (int k = 0; k < c; k++)
+            {
+                float top = src[(y0 * w + x0) * c + k] * (1 - ax) + src[(y0 * w + x1) * c + k] * ax;
+                float bot = src[(y1 * w + x0) * c + k] * (1 - ax) + src[(y1 * w + x1) * c + k] * ax;
+                dst[(i * tw + j) * c + k] = top * (1 - ay) + bot * ay;
+            }
+        }
+    }
+}
+
+static void ref_area(float *dst, const uint8_t *src, int h, int w, int th, int tw, int c)
+{
+    for (int i = 0; i < th; i++)
+    {
+        int y0 = i * h / th, y1 = (i + 1) * h / th;
+        y1 = y1 > y0 ? y1 : y0 + 1;
+        for (int j = 0; j < tw; j++)
+        {
+            int x0 = j * w / tw, x1 = (j + 1) * w / tw;
+            x1 = x1 > x0 ? x1 : x0 + 1;
+            for (int k = 0; k < c; k++)
+            {
+                float s = 0;
+                for (int y = y0; y < y1; y++)
+                    for (int x = x0; x < x1; x++)
+                        s += src[(y * w + x) * c + k];
+                dst[(i * tw + j) * c + k] = s / ((y1 - y0) * (x1 - x0));
+            }
+        }
+    }
+}
+
+static int max_error(const uint8_t *out, const float *ref, int n)
+{
+    int err = 0;
+    for (int i = 0; i < n; i++)
+    {
+        float d = out[i] - ref[i];
+        d = d < 0 ? -d : d;
+        err = (int)(d + 0.5f) > err ? (int)(d + 0.5f) : err;
+    }
+    return err;
+}
+
+static void check_filter(uint8_t format, uint8_t channels, uint8_t filter, int th, int tw)
+{
+    int n = th * tw * channels;
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *full = malloc(SRC_H * SRC_W * channels);
+    uint8_t *out = malloc(n);
+    float *ref = malloc(n * sizeof(float));
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(full);
+    TEST_ASSERT_NOT_NULL(out);
+    TEST_ASSERT_NOT_NULL(ref);
+
+    if (format == ISP_FORMAT_RGB565)
+        fill_rgb565(src, SRC_H, SRC_W);
+    else
+        fill_yuv422p(src, SRC_H, SRC_W);
+
+    // colour conversion at full size is the reference input of the float filters
+    isp_config_t config = {.format = format, .channels = channels, .h = SRC_H, .w = SRC_W, .th = SRC_H, .tw = SRC_W};
+    TEST_ASSERT_EQUAL(0, isp_convert(full, src, &config));
+
+    config.filter = filter;
+    config.th = th;
+    config.tw = tw;
+    TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+    isp_release(&config);
+
+    if (filter == ISP_FILTER_BILINEAR)
+        ref_bilinear(ref, full, SRC_H, SRC_W, th, tw, channels);
+    else
+        ref_area(ref, full, SRC_H, SRC_W, th, tw, channels);
+
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_error(out, ref, n));
+
+    free(src);
+    free(full);
+    free(out);
+    free(ref);
+}
+
+TEST_CASE("isp bilinear matches float reference", "[isp]")
+{
+    check_filter(ISP_FORMAT_RGB565, 3, ISP_FILTER_BILINEAR, DST_H, DST_W);
+    check_filter(ISP_FORMAT_RGB565, 1, ISP_FILTER_BILINEAR, DST_H, DST_W);
+    check_filter(ISP_FORMAT_YUV422P, 3, ISP_FILTER_BILINEAR, DST_H, DST_W);
+    check_filter(ISP_FORMAT_YUV422P, 1, ISP_FILTER_BILINEAR, DST_H, DST_W);
+    check_filter(ISP_FORMAT_RGB565, 3, ISP_FILTER_BILINEAR, 300, 400);
+}
+
+TEST_CASE("isp area matches float reference", "[isp]")
+{
+    check_filter(ISP_FORMAT_RGB565, 3, ISP_FILTER_AREA, DST_H, DST_W);
+    check_filter(ISP_FORMAT_RGB565, 1, ISP_FILTER_AREA, DST_H, DST_W);
+    check_filter(ISP_FORMAT_YUV422P, 3, ISP_FILTER_AREA, DST_H, DST_W);
+    check_filter(ISP_FORMAT_YUV422P, 1, ISP_FILTER_AREA, DST_H, DST_W);
+    check_filter(ISP_FORMAT_RGB565, 3, ISP_FILTER_AREA, 77, 51);
+}
+
+TEST_CASE("isp int8 output follows the quantization table", "[isp]")
+{
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *out = malloc(DST_H * DST_W * 3);
+    int8_t *qout = malloc(DST_H * DST_W * 3);
+    int8_t qtable[256];
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(out);
+    TEST_ASSERT_NOT_NULL(qout);
+    fill_rgb565(src, SRC_H, SRC_W);
+    isp_quant_table(qtable, 1.0f / 255, -128);
+
+    for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+    {
+        isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .filter = filter, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+        TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+        config.qtable = qtable;
+        TEST_ASSERT_EQUAL(0, isp_convert(qout, src, &config));
+        isp_release(&config);
+        for (int i = 0; i < DST_H * DST_W * 3; i++)
+        {
+            TEST_ASSERT_EQUAL(out[i] - 128, qout[i]);
+        }
+    }
+    free(qout);
+    free(out);
+    free(src);
+}
+
+TEST_CASE("isp letterbox pads around the resized frame", "[isp]")
+{
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *plain = malloc(DST_W * DST_W * 3);
+    uint8_t *out = malloc(DST_H * DST_W * 3);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(plain);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb565(src, SRC_H, SRC_W);
+
+    // 320x240 into 96x96 keeps 96x72 of content, 12 rows of padding above and below
+    isp_config_t ref = {.format = ISP_FORMAT_RGB565, .channels = 3, .filter = ISP_FILTER_AREA, .h = SRC_H, .w = SRC_W, .th = 72, .tw = DST_W};
+    TEST_ASSERT_EQUAL(0, isp_convert(plain, src, &ref));
+    isp_release(&ref);
+
+    isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .filter = ISP_FILTER_AREA, .letterbox = 1, .pad = 114, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+    TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+    TEST_ASSERT_EQUAL(0, config.transform.ox);
+    TEST_ASSERT_EQUAL(12, config.transform.oy);
+    TEST_ASSERT_EQUAL(72, config.transform.ch);
+    for (int i = 0; i < DST_H; i++)
+    {
+        for (int k = 0; k < DST_W * 3; k++)
+        {
+            uint8_t expect = (i < 12 || i >= 84) ? 114 : plain[(i - 12) * DST_W * 3 + k];
+            TEST_ASSERT_EQUAL(expect, out[i * DST_W * 3 + k]);
+        }
+    }
+
+    // target coordinates map back onto the source frame
+    TEST_ASSERT_EQUAL(0, isp_source_y(&config.transform, 12));
+    TEST_ASSERT_EQUAL(SRC_H / 2, isp_source_y(&config.transform, 48));
+    TEST_ASSERT_EQUAL(SRC_W / 2, isp_source_x(&config.transform, 48));
+    TEST_ASSERT_EQUAL(SRC_W, isp_source_w(&config.transform, DST_W));
+
+    // with keep_pad the padding of the same buffer is not written again
+    config.keep_pad = 1;
+    TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+    memset(out, 0, DST_W * 3);
+    TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+    TEST_ASSERT_EQUAL(0, out[0]);
+    TEST_ASSERT_EQUAL(114, out[DST_H * DST_W * 3 - 1]);
+
+    // two buffers taking turns, like the inputs of two slots, keep their padding each
+    uint8_t *other = malloc(DST_H * DST_W * 3);
+    TEST_ASSERT_NOT_NULL(other);
+    TEST_ASSERT_EQUAL(0, isp_convert(other, src, &config));
+    TEST_ASSERT_EQUAL(114, other[0]);
+    memset(other, 0, DST_W * 3);
+    for (int round = 0; round < 3; round++)
+    {
+        TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+        TEST_ASSERT_EQUAL(0, isp_convert(other, src, &config));
+    }
+    TEST_ASSERT_EQUAL(0, out[0]);
+    TEST_ASSERT_EQUAL(0, other[0]);
+    free(other);
+
+    // rotated targets pad the rotated borders, a new rotation lays the padding out again
+    config.rotation = ROTATION_LEFT;
+    TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+    for (int i = 0; i < DST_H; i++)
+    {
+        for (int j = 0; j < DST_W; j++)
+        {
+            uint8_t expect = (i < 12 || i >= 84) ? 114 : plain[((i - 12) * DST_W + j) * 3];
+            TEST_ASSERT_EQUAL(expect, out[((DST_W - 1 - j) * DST_H + i) * 3]);
+        }
+    }
+    isp_release(&config);
+    free(out);
+    free(plain);
+    free(src);
+}
+
+TEST_CASE("isp roi matches converting a cropped frame", "[isp]")
+{
+    const isp_rect_t roi = {.x = 70, .y = 30, .w = 150, .h = 120};
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *crop = malloc(roi.h * roi.w * 2);
+    uint8_t *expect = malloc(DST_H * DST_W * 3);
+    uint8_t *out = malloc(DST_H * DST_W * 3);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(crop);
+    TEST_ASSERT_NOT_NULL(expect);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb565(src, SRC_H, SRC_W);
+    for (int y = 0; y < roi.h; y++)
+    {
+        memcpy(crop + y * roi.w * 2, src + ((roi.y + y) * SRC_W + roi.x) * 2, roi.w * 2);
+    }
+
+    for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+    {
+        for (uint8_t channels = 1; channels <= 3; channels += 2)
+        {
+            isp_config_t ref = {.format = ISP_FORMAT_RGB565, .channels = channels, .filter = filter, .h = roi.h, .w = roi.w, .th = DST_H, .tw = DST_W};
+            isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = channels, .filter = filter, .h = SRC_H, .w = SRC_W, .roi = roi, .th = DST_H, .tw = DST_W};
+            TEST_ASSERT_EQUAL(0, isp_convert(expect, crop, &ref));
+            TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expect, out, DST_H * DST_W * channels);
+            TEST_ASSERT_EQUAL(roi.x, isp_source_x(&config.transform, 0));
+            TEST_ASSERT_EQUAL(roi.y + roi.h / 2, isp_source_y(&config.transform, DST_H / 2));
+            isp_release(&ref);
+            isp_release(&config);
+        }
+    }
+
+    // regions are clipped to the frame, and one entirely outside is an error
+    isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+    config.roi = (isp_rect_t){.x = SRC_W - 10, .y = SRC_H - 10, .w = 100, .h = 100};
+    TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+    TEST_ASSERT_EQUAL(SRC_W - 10, isp_source_x(&config.transform, 0));
+    TEST_ASSERT_EQUAL(SRC_W, isp_source_x(&config.transform, DST_W));
+    config.roi = (isp_rect_t){.x = SRC_W, .y = 0, .w = 10, .h = 10};
+    TEST_ASSERT_EQUAL(-1, isp_convert(out, src, &config));
+    isp_release(&config);
+    free(out);
+    free(expect);
+    free(crop);
+    free(src);
+}
+
+TEST_CASE("isp reuses its tables across regions of any size", "[isp]")
+{
+    // boxes of a cascade, one region after the other through the same config
+    const isp_rect_t boxes[] = {{10, 20, 64, 48}, {100, 50, 30, 90}, {SRC_W - 40, SRC_H - 30, 80, 80}, {5, 5, 200, 150}};
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *expect = malloc(DST_H * DST_W * 3);
+    uint8_t *out = malloc(DST_H * DST_W * 3);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(expect);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb565(src, SRC_H, SRC_W);
+
+    for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+    {
+        isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .filter = filter, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+        isp_plan_t *plan = NULL;
+        for (size_t b = 0; b < sizeof(boxes) / sizeof(boxes[0]); b++)
+        {
+            isp_config_t ref = config;
+            ref.plan = NULL;
+            ref.roi = boxes[b];
+            config.roi = boxes[b];
+            TEST_ASSERT_EQUAL(0, isp_convert(expect, src, &ref));
+            TEST_ASSERT_EQUAL(0, isp_convert(out, src, &config));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expect, out, DST_H * DST_W * 3);
+            TEST_ASSERT_EQUAL(ref.transform.sx, config.transform.sx);
+            TEST_ASSERT_EQUAL(ref.transform.y0, config.transform.y0);
+            isp_release(&ref);
+
+            // the same tables, rebuilt in place
+            plan = plan ? plan : config.plan;
+            TEST_ASSERT_EQUAL_PTR(plan, config.plan);
+        }
+        isp_release(&config);
+    }
+    free(out);
+    free(expect);
+    free(src);
+}
+
+TEST_CASE("isp parallel split matches a single core", "[isp]")
+{
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *single = malloc(DST_H * DST_W * 3);
+    uint8_t *split = malloc(DST_H * DST_W * 3);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(single);
+    TEST_ASSERT_NOT_NULL(split);
+    TEST_ASSERT_EQUAL(0, isp_worker_init());
+    fill_rgb565(src, SRC_H, SRC_W);
+
+    for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+    {
+        for (uint8_t rotation = ROTATION_UP; rotation <= ROTATION_DOWN; rotation++)
+        {
+            isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .rotation = rotation, .filter = filter, .letterbox = 1, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+            TEST_ASSERT_EQUAL(0, isp_convert(single, src, &config));
+            config.parallel = 1;
+            TEST_ASSERT_EQUAL(0, isp_convert(split, src, &config));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(single, split, DST_H * DST_W * 3);
+            isp_release(&config);
+        }
+    }
+    free(split);
+    free(single);
+    free(src);
+}
+
+typedef struct
+{
+    const char *name;
+    void (*rgb888)(uint8_t *pdst, const uint8_t *psrc, int n);
+    void (*gray)(uint8_t *pdst, const uint8_t *psrc, int n);
+} unpack_kernel_t;
+
+static const unpack_kernel_t _unpack_kernels[] = {
+    {"default", rgb565_unpack_rgb888, rgb565_unpack_gray},
+    {"table", rgb565_unpack_rgb888_table, rgb565_unpack_gray_table},
+    {"word-parallel", rgb565_unpack_rgb888_swar, rgb565_unpack_gray_swar},
+};
+
+TEST_CASE("isp rgb565 unpack is bit-exact with the lookup tables", "[isp]")
+{
+    extern const uint8_t _RGB565_TO_RGB_888_TABLE_5[];
+    extern const uint8_t _RGB565_TO_RGB_888_TABLE_6[];
+    const int n = 65536;
+    uint8_t *src = malloc(n * 2 + 1);
+    uint8_t *rgb = malloc(n * 3);
+    uint8_t *gray = malloc(n);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(rgb);
+    TEST_ASSERT_NOT_NULL(gray);
+
+    // every pixel value once, and once more from an odd address with a tail shorter than a block
+    for (int offset = 0; offset <= 1; offset++)
+    {
+        int count = n - offset * 13;
+        for (int v = 0; v < count; v++)
+        {
+            src[offset + v * 2] = v >> 8;
+            src[offset + v * 2 + 1] = v & 0xFF;
+        }
+        // the kernel in use and both of the ones it is chosen from
+        for (int kernel = 0; kernel < 3; kernel++)
+        {
+            memset(rgb, 0, n * 3);
+            memset(gray, 0, n);
+            _unpack_kernels[kernel].rgb888(rgb, src + offset, count);
+            _unpack_kernels[kernel].gray(gray, src + offset, count);
+            for (int v = 0; v < count; v++)
+            {
+                uint8_t hi = _RGB565_TO_RGB_888_TABLE_5[v >> 11];
+                uint8_t g = _RGB565_TO_RGB_888_TABLE_6[(v >> 5) & 0x3F];
+                uint8_t lo = _RGB565_TO_RGB_888_TABLE_5[v & 0x1F];
+                TEST_ASSERT_EQUAL(hi, rgb[v * 3 + 0]);
+                TEST_ASSERT_EQUAL(g, rgb[v * 3 + 1]);
+                TEST_ASSERT_EQUAL(lo, rgb[v * 3 + 2]);
+                TEST_ASSERT_EQUAL((lo * 299 + g * 587 + hi * 114) / 1000, gray[v]);
+            }
+        }
+    }
+    free(gray);
+    free(rgb);
+    free(src);
+}
+
+TEST_CASE("isp rgb565 unpack kernels", "[isp][performance]")
+{
+    // what CONFIG_ISP_RGB565_SWAR is decided on, run it on the target
+    const int rounds = 20;
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    uint8_t *dst = malloc(SRC_H * SRC_W * 3);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(dst);
+    fill_rgb565(src, SRC_H, SRC_W);
+
+    for (int kernel = 1; kernel < 3; kernel++)
+    {
+        const unpack_kernel_t *k = &_unpack_kernels[kernel];
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            for (int y = 0; y < SRC_H; y++)
+                k->rgb888(dst + y * SRC_W * 3, src + y * SRC_W * 2, SRC_W);
+        }
+        clock_t mid = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            for (int y = 0; y < SRC_H; y++)
+                k->gray(dst + y * SRC_W, src + y * SRC_W * 2, SRC_W);
+        }
+        clock_t end = clock();
+        printf("%dx%d rgb565 unpack %s: rgb888 %.3f ms/frame, gray %.3f ms/frame\n", SRC_W, SRC_H, k->name,
+               (mid - start) * 1000.0 / CLOCKS_PER_SEC / rounds, (end - mid) * 1000.0 / CLOCKS_PER_SEC / rounds);
+    }
+    free(dst);
+    free(src);
+}
+
+/* simulated line source: delivers the frame a stripe at a time, like a camera DMA filling its buffer */
+typedef struct
+{
+    const uint8_t *image; /* what the sensor sees */
+    uint8_t *frame;       /* the buffer being filled */
+    int rows;             /* rows delivered so far */
+    int stripes;
+    const uint8_t *expect; /* for checking that output rows were written before the frame completed */
+    uint8_t *dst;
+    int early;
+} line_source_t;
+
+#define STRIPE_LINES 16
+
+static int line_source_rows(void *ctx, int rows)
+{
+    line_source_t *source = (line_source_t *)ctx;
+
+    while (source->rows < rows)
+    {
+        int n = SRC_H - source->rows < STRIPE_LINES ? SRC_H - source->rows : STRIPE_LINES;
+        if (source->rows + n == SRC_H)
+        {
+            // the last stripe is about to land, the top of the target is already done
+            source->early = memcmp(source->dst, source->expect, DST_W * 3) == 0;
+        }
+        memcpy(source->frame + source->rows * SRC_W * 2, source->image + source->rows * SRC_W * 2, n * SRC_W * 2);
+        source->rows += n;
+        source->stripes++;
+    }
+    return source->rows;
+}
+
+TEST_CASE("isp converts a streamed frame stripe by stripe", "[isp]")
+{
+    uint8_t *image = malloc(SRC_H * SRC_W * 2);
+    uint8_t *frame = malloc(SRC_H * SRC_W * 2);
+    uint8_t *expect = malloc(DST_H * DST_W * 3);
+    uint8_t *out = malloc(DST_H * DST_W * 3);
+    TEST_ASSERT_NOT_NULL(image);
+    TEST_ASSERT_NOT_NULL(frame);
+    TEST_ASSERT_NOT_NULL(expect);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb565(image, SRC_H, SRC_W);
+
+    for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+    {
+        line_source_t source = {.image = image, .frame = frame, .expect = expect, .dst = out};
+        isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .filter = filter, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+        TEST_ASSERT_EQUAL(0, isp_convert(expect, image, &config));
+
+        memset(frame, 0x55, SRC_H * SRC_W * 2);
+        memset(out, 0, DST_H * DST_W * 3);
+        config.source_rows = line_source_rows;
+        config.source_ctx = &source;
+        TEST_ASSERT_EQUAL(0, isp_convert(out, frame, &config));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expect, out, DST_H * DST_W * 3);
+        TEST_ASSERT_EQUAL((SRC_H + STRIPE_LINES - 1) / STRIPE_LINES, source.stripes);
+        TEST_ASSERT_TRUE(source.early);
+        isp_release(&config);
+    }
+
+    // planar sources cannot be streamed
+    isp_config_t config = {.format = ISP_FORMAT_YUV422P, .channels = 3, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W, .source_rows = line_source_rows};
+    TEST_ASSERT_EQUAL(-1, isp_convert(out, frame, &config));
+    free(out);
+    free(expect);
+    free(frame);
+    free(image);
+}
+
+TEST_CASE("isp packed yuv422 matches the planar path", "[isp]")
+{
+    uint8_t *planar = malloc(SRC_H * SRC_W * 2);
+    uint8_t *packed = malloc(SRC_H * SRC_W * 2);
+    uint8_t *luma = malloc(SRC_H * SRC_W);
+    uint8_t *expect = malloc(DST_H * DST_W * 3);
+    uint8_t *out = malloc(DST_H * DST_W * 3);
+    float *ref = malloc(DST_H * DST_W * sizeof(float));
+    TEST_ASSERT_NOT_NULL(planar);
+    TEST_ASSERT_NOT_NULL(packed);
+    TEST_ASSERT_NOT_NULL(luma);
+    TEST_ASSERT_NOT_NULL(expect);
+    TEST_ASSERT_NOT_NULL(out);
+    TEST_ASSERT_NOT_NULL(ref);
+    fill_yuv422p(planar, SRC_H, SRC_W);
+    for (int i = 0; i < SRC_H * SRC_W; i++)
+    {
+        packed[i * 2] = planar[i];
+        packed[i * 2 + 1] = planar[SRC_H * SRC_W + (i >> 1) + (i & 1) * SRC_H * SRC_W / 2];
+        luma[i] = planar[i];
+    }
+
+    for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+    {
+        isp_config_t p = {.format = ISP_FORMAT_YUV422P, .channels = 3, .filter = filter, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+        isp_config_t q = {.format = ISP_FORMAT_YUV422, .channels = 3, .filter = filter, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+        TEST_ASSERT_EQUAL(0, isp_convert(expect, planar, &p));
+        TEST_ASSERT_EQUAL(0, isp_convert(out, packed, &q));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expect, out, DST_H * DST_W * 3);
+        isp_release(&p);
+        isp_release(&q);
+    }
+
+    // gray is the luma itself: a strided copy at full size, resampled luma otherwise
+    uint8_t *full = malloc(SRC_H * SRC_W);
+    TEST_ASSERT_NOT_NULL(full);
+    TEST_ASSERT_EQUAL(0, yuv422_to_gray(full, packed, SRC_H, SRC_W, SRC_H, SRC_W, ROTATION_UP));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(luma, full, SRC_H * SRC_W);
+    isp_config_t config = {.format = ISP_FORMAT_YUV422, .channels = 1, .filter = ISP_FILTER_AREA, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W};
+    TEST_ASSERT_EQUAL(0, isp_convert(out, packed, &config));
+    ref_area(ref, luma, SRC_H, SRC_W, DST_H, DST_W, 1);
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_error(out, ref, DST_H * DST_W));
+    isp_release(&config);
+    free(full);
+    free(ref);
+    free(out);
+    free(expect);
+    free(luma);
+    free(packed);
+    free(planar);
+}
+
+TEST_CASE("isp filter throughput", "[isp][performance]")
+{
+    static const char *names[] = {"nearest", "bilinear", "area"};
+    const int rounds = 20;
+    uint8_t *src = malloc(SRC_H * SRC_W * 2);
+    int8_t *dst = malloc(DST_H * DST_W * 3);
+    uint8_t *full = malloc(SRC_H * SRC_W * 3);
+    float *ref = malloc(DST_H * DST_W * 3 * sizeof(float));
+    int8_t qtable[256];
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(dst);
+    TEST_ASSERT_NOT_NULL(full);
+    TEST_ASSERT_NOT_NULL(ref);
+    fill_rgb565(src, SRC_H, SRC_W);
+    isp_quant_table(qtable, 1.0f / 255, -128);
+    TEST_ASSERT_EQUAL(0, isp_worker_init());
+
+    for (uint8_t parallel = 0; parallel <= 1; parallel++)
+    {
+        for (uint8_t filter = ISP_FILTER_NEAREST; filter <= ISP_FILTER_AREA; filter++)
+        {
+            isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .filter = filter, .parallel = parallel, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W, .qtable = qtable};
+            isp_convert(dst, src, &config);
+            clock_t start = clock();
+            for (int r = 0; r < rounds; r++)
+            {
+                isp_convert(dst, src, &config);
+            }
+            clock_t end = clock();
+            isp_release(&config);
+            printf("%dx%d rgb565 -> %dx%d int8 %s%s: %.3f ms/frame\n", SRC_W, SRC_H, DST_W, DST_H, names[filter],
+                   parallel ? " (parallel)" : "", (end - start) * 1000.0 / CLOCKS_PER_SEC / rounds);
+        }
+    }
+
+    // 1-channel input: luma of packed yuv422 against the weighted sum over rgb565
+    for (uint8_t format = ISP_FORMAT_RGB565; format <= ISP_FORMAT_YUV422; format += ISP_FORMAT_YUV422)
+    {
+        isp_config_t config = {.format = format, .channels = 1, .filter = ISP_FILTER_AREA, .h = SRC_H, .w = SRC_W, .th = DST_H, .tw = DST_W, .qtable = qtable};
+        isp_convert(dst, src, &config);
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            isp_convert(dst, src, &config);
+        }
+        clock_t end = clock();
+        isp_release(&config);
+        printf("%dx%d %s -> %dx%d int8 gray area: %.3f ms/frame\n", SRC_W, SRC_H, format == ISP_FORMAT_RGB565 ? "rgb565" : "yuv422",
+               DST_W, DST_H, (end - start) * 1000.0 / CLOCKS_PER_SEC / rounds);
+    }
+
+    // contiguous unpack of a whole frame, against the per-pixel gather of a (one column narrower) resize
+    isp_config_t gather = {.format = ISP_FORMAT_RGB565, .channels = 3, .h = SRC_H, .w = SRC_W, .th = SRC_H, .tw = SRC_W - 1};
+    isp_convert(full, src, &gather);
+    clock_t unpack_start = clock();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (int y = 0; y < SRC_H; y++)
+            rgb565_unpack_rgb888(full + y * SRC_W * 3, src + y * SRC_W * 2, SRC_W);
+    }
+    clock_t unpack_end = clock();
+    for (int r = 0; r < rounds; r++)
+    {
+        isp_convert(full, src, &gather);
+    }
+    clock_t gather_end = clock();
+    isp_release(&gather);
+    printf("%dx%d rgb565 unpack: %.3f ms/frame, gather: %.3f ms/frame\n", SRC_W, SRC_H,
+           (unpack_end - unpack_start) * 1000.0 / CLOCKS_PER_SEC / rounds, (gather_end - unpack_end) * 1000.0 / CLOCKS_PER_SEC / rounds);
+
+    // the float references, for scale
+    isp_config_t config = {.format = ISP_FORMAT_RGB565, .channels = 3, .h = SRC_H, .w = SRC_W, .th = SRC_H, .tw = SRC_W};
+    isp_convert(full, src, &config);
+    isp_release(&config);
+    clock_t start = clock();
+    for (int r = 0; r < rounds; r++)
+    {
+        ref_bilinear(ref, full, SRC_H, SRC_W, DST_H, DST_W, 3);
+    }
+    clock_t mid = clock();
+    for (int r = 0; r < rounds; r++)
+    {
+        ref_area(ref, full, SRC_H, SRC_W, DST_H, DST_W, 3);
+    }
+    clock_t end = clock();
+    printf("float reference bilinear: %.3f ms/frame, area: %.3f ms/frame\n",
+           (mid - start) * 1000.0 / CLOCKS_PER_SEC / rounds, (end - mid) * 1000.0 / CLOCKS_PER_SEC / rounds);
+
+    free(src);
+    free(dst);
+    free(full);
+    free(ref);
+}
@@ -0,0 +1,398 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "unity.h"
+
+#include "isp.h"
+#include "jpeg.h"
+
+/* baseline q90 encodings of fill_rgb888_pattern(), see gen_jpeg_samples.py */
+extern const unsigned char jpeg_sample_420[], jpeg_sample_422[], jpeg_sample_444[], jpeg_sample_gray[], jpeg_sample_qvga[];
+extern const unsigned int jpeg_sample_420_len, jpeg_sample_422_len, jpeg_sample_444_len, jpeg_sample_gray_len, jpeg_sample_qvga_len;
+
+#define SAMPLE_H 120
+#define SAMPLE_W 160
+
+typedef struct
+{
+    const char *name;
+    const unsigned char *data;
+    const unsigned int *len;
+    int channels; /* of the encoded image */
+} jpeg_sample_t;
+
+static const jpeg_sample_t _samples[] = {
+    {"4:2:0", jpeg_sample_420, &jpeg_sample_420_len, 3},
+    {"4:2:2, restart markers", jpeg_sample_422, &jpeg_sample_422_len, 3},
+    {"4:4:4", jpeg_sample_444, &jpeg_sample_444_len, 3},
+    {"gray", jpeg_sample_gray, &jpeg_sample_gray_len, 1},
+};
+
+/* gradients with an inverted square, must match pattern() in gen_jpeg_samples.py */
+static void fill_rgb888_pattern(uint8_t *buf, int h, int w)
+{
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            int r = x * 255 / (w - 1), g = y * 255 / (h - 1), b = (x + y) * 255 / (w + h - 2);
+            if (x >= w / 4 && x < w / 2 && y >= h / 4 && y < h / 2)
+            {
+                r = 255 - r;
+                g = 255 - g;
+                b = 40;
+            }
+            buf[(y * w + x) * 3] = r;
+            buf[(y * w + x) * 3 + 1] = g;
+            buf[(y * w + x) * 3 + 2] = b;
+        }
+    }
+}
+
+static void rgb888_to_luma(uint8_t *dst, const uint8_t *src, int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        dst[i] = (src[i * 3] * 299 + src[i * 3 + 1] * 587 + src[i * 3 + 2] * 114 + 500) / 1000;
+    }
+}
+
+/* box average of the (y, x, h, w) region of the pattern down by an integer factor */
+static void pattern_box(uint8_t *dst, const uint8_t *src, int w, int c, int y, int x, int h, int rw, int f)
+{
+    for (int i = 0; i < h / f; i++)
+    {
+        for (int j = 0; j < rw / f; j++)
+        {
+            for (int k = 0; k < c; k++)
+            {
+                int sum = 0;
+                for (int dy = 0; dy < f; dy++)
+                    for (int dx = 0; dx < f; dx++)
+                        sum += src[((y + i * f + dy) * w + x + j * f + dx) * c + k];
+                dst[(i * (rw / f) + j) * c + k] = (sum + f * f / 2) / (f * f);
+            }
+        }
+    }
+}
+
+static float mean_error(const uint8_t *a, const uint8_t *b, int n)
+{
+    long sum = 0;
+    for (int i = 0; i < n; i++)
+    {
+        sum += abs(a[i] - b[i]);
+    }
+    return (float)sum / n;
+}
+
+/* apply edit to the payload of every segment of a marker before the scan, to corrupt the tables in place */
+static void edit_segments(uint8_t *jpg, size_t len, uint8_t marker, void (*edit)(uint8_t *p, int n))
+{
+    size_t i = 2;
+    while (i + 4 <= len && jpg[i] == 0xFF && jpg[i + 1] != 0xDA)
+    {
+        int n = ((jpg[i + 2] << 8) | jpg[i + 3]) - 2;
+        if (jpg[i + 1] == marker)
+            edit(jpg + i + 4, n);
+        i += 4 + n;
+    }
+}
+
+/* the stream with its DQT tables rewritten as 16-bit tables of step q, 64 bytes longer per table */
+static size_t wide_quant(uint8_t *dst, const uint8_t *jpg, size_t len, uint16_t q)
+{
+    size_t i = 2, o = 2;
+    memcpy(dst, jpg, 2);
+    while (i + 4 <= len && jpg[i] == 0xFF && jpg[i + 1] != 0xDA)
+    {
+        int n = ((jpg[i + 2] << 8) | jpg[i + 3]) - 2;
+        if (jpg[i + 1] == 0xDB)
+        {
+            int tables = n / 65, m = tables * 129 + 2;
+            dst[o++] = 0xFF;
+            dst[o++] = 0xDB;
+            dst[o++] = m >> 8;
+            dst[o++] = m & 0xFF;
+            for (int t = 0; t < tables; t++)
+            {
+                dst[o++] = 0x10 | (jpg[i + 4 + t * 65] & 15);
+                for (int k = 0; k < 64; k++, o += 2)
+                {
+                    dst[o] = q >> 8;
+                    dst[o + 1] = q & 0xFF;
+                }
+            }
+        }
+        else
+        {
+            memcpy(dst + o, jpg + i, 4 + n);
+            o += 4 + n;
+        }
+        i += 4 + n;
+    }
+    memcpy(dst + o, jpg + i, len - i);
+    return o + len - i;
+}
+
+/* AC coefficients of magnitude 1 coded as 15-bit magnitudes, which no baseline stream has */
+static void long_ac(uint8_t *p, int n)
+{
+    for (int t = 0; t + 17 <= n;)
+    {
+        int total = 0;
+        for (int i = 0; i < 16; i++)
+            total += p[t + 1 + i];
+        for (int i = 0; (p[t] >> 4) == 1 && i < total; i++)
+            p[t + 17 + i] = p[t + 17 + i] == 0x01 ? 0x0F : p[t + 17 + i];
+        t += 17 + total;
+    }
+}
+
+TEST_CASE("jpeg reads the frame size", "[jpeg]")
+{
+    int w = 0, h = 0;
+    TEST_ASSERT_EQUAL(0, jpeg_size(jpeg_sample_420, jpeg_sample_420_len, &w, &h));
+    TEST_ASSERT_EQUAL(SAMPLE_W, w);
+    TEST_ASSERT_EQUAL(SAMPLE_H, h);
+    TEST_ASSERT_EQUAL(0, jpeg_size(jpeg_sample_qvga, jpeg_sample_qvga_len, &w, &h));
+    TEST_ASSERT_EQUAL(320, w);
+    TEST_ASSERT_EQUAL(240, h);
+    TEST_ASSERT_EQUAL(-1, jpeg_size(jpeg_sample_420 + 2, jpeg_sample_420_len - 2, &w, &h));
+}
+
+TEST_CASE("jpeg decodes every sampling layout at full scale", "[jpeg]")
+{
+    uint8_t *pattern = malloc(SAMPLE_H * SAMPLE_W * 3);
+    uint8_t *luma = malloc(SAMPLE_H * SAMPLE_W);
+    uint8_t *out = malloc(SAMPLE_H * SAMPLE_W * 3);
+    TEST_ASSERT_NOT_NULL(pattern);
+    TEST_ASSERT_NOT_NULL(luma);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb888_pattern(pattern, SAMPLE_H, SAMPLE_W);
+    rgb888_to_luma(luma, pattern, SAMPLE_H * SAMPLE_W);
+
+    for (size_t i = 0; i < sizeof(_samples) / sizeof(_samples[0]); i++)
+    {
+        const jpeg_sample_t *s = &_samples[i];
+        for (uint8_t channels = 1; channels <= 3; channels += 2)
+        {
+            jpeg_decoder_t decoder = {0};
+            isp_config_t config = {.channels = channels, .th = SAMPLE_H, .tw = SAMPLE_W};
+            TEST_ASSERT_EQUAL(0, jpeg_convert(out, s->data, *s->len, &config, &decoder));
+            TEST_ASSERT_EQUAL(1, decoder.scale);
+
+            float err;
+            if (channels == 1 || s->channels == 1)
+            {
+                // gray images come out as R = G = B
+                for (int p = 0; channels == 3 && p < SAMPLE_H * SAMPLE_W; p++)
+                {
+                    TEST_ASSERT_EQUAL(out[p * 3], out[p * 3 + 1]);
+                    TEST_ASSERT_EQUAL(out[p * 3], out[p * 3 + 2]);
+                    out[p] = out[p * 3];
+                }
+                err = mean_error(out, luma, SAMPLE_H * SAMPLE_W);
+            }
+            else
+            {
+                err = mean_error(out, pattern, SAMPLE_H * SAMPLE_W * 3);
+            }
+            printf("%s -> %d channel(s): mean error %.2f\n", s->name, channels, err);
+            // q90 with subsampled chroma across the square's hard edges
+            TEST_ASSERT_LESS_THAN(3.0f, err);
+
+            isp_release(&config);
+            jpeg_release(&decoder);
+        }
+    }
+    free(pattern);
+    free(luma);
+    free(out);
+}
+
+TEST_CASE("jpeg dct scaling matches a box filtered frame", "[jpeg]")
+{
+    uint8_t *pattern = malloc(SAMPLE_H * SAMPLE_W * 3);
+    uint8_t *ref = malloc(SAMPLE_H * SAMPLE_W * 3);
+    uint8_t *out = malloc(SAMPLE_H * SAMPLE_W * 3);
+    TEST_ASSERT_NOT_NULL(pattern);
+    TEST_ASSERT_NOT_NULL(ref);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb888_pattern(pattern, SAMPLE_H, SAMPLE_W);
+
+    for (int scale = 2; scale <= 8; scale <<= 1)
+    {
+        int th = SAMPLE_H / scale, tw = SAMPLE_W / scale;
+        jpeg_decoder_t decoder = {0};
+        isp_config_t config = {.channels = 3, .filter = ISP_FILTER_AREA, .th = th, .tw = tw};
+        TEST_ASSERT_EQUAL(0, jpeg_convert(out, jpeg_sample_444, jpeg_sample_444_len, &config, &decoder));
+        TEST_ASSERT_EQUAL(scale, decoder.scale);
+        TEST_ASSERT_EQUAL(scale << 16, config.transform.sx);
+        TEST_ASSERT_EQUAL(scale << 16, config.transform.sy);
+
+        pattern_box(ref, pattern, SAMPLE_W, 3, 0, 0, SAMPLE_H, SAMPLE_W, scale);
+        float err = mean_error(out, ref, th * tw * 3);
+        printf("4:4:4 at 1/%d: mean error %.2f\n", scale, err);
+        TEST_ASSERT_LESS_THAN(3.0f, err);
+
+        isp_release(&config);
+        jpeg_release(&decoder);
+    }
+
+    // a target between two scales decodes at the finer one and lets isp do the rest
+    jpeg_decoder_t decoder = {0};
+    isp_config_t config = {.channels = 3, .th = 48, .tw = 64};
+    TEST_ASSERT_EQUAL(0, jpeg_convert(out, jpeg_sample_420, jpeg_sample_420_len, &config, &decoder));
+    TEST_ASSERT_EQUAL(2, decoder.scale);
+    TEST_ASSERT_EQUAL(0, isp_source_x(&config.transform, 0));
+    TEST_ASSERT_EQUAL(SAMPLE_W, isp_source_x(&config.transform, 64));
+    TEST_ASSERT_EQUAL(SAMPLE_H, isp_source_y(&config.transform, 48));
+    isp_release(&config);
+    jpeg_release(&decoder);
+
+    free(pattern);
+    free(ref);
+    free(out);
+}
+
+TEST_CASE("jpeg roi maps back to the full frame", "[jpeg]")
+{
+    const isp_rect_t roi = {40, 32, 80, 64};
+    uint8_t *pattern = malloc(SAMPLE_H * SAMPLE_W * 3);
+    uint8_t *ref = malloc(SAMPLE_H * SAMPLE_W * 3);
+    uint8_t *out = malloc(SAMPLE_H * SAMPLE_W * 3);
+    TEST_ASSERT_NOT_NULL(pattern);
+    TEST_ASSERT_NOT_NULL(ref);
+    TEST_ASSERT_NOT_NULL(out);
+    fill_rgb888_pattern(pattern, SAMPLE_H, SAMPLE_W);
+
+    jpeg_decoder_t decoder = {0};
+    isp_config_t config = {.channels = 3, .filter = ISP_FILTER_AREA, .roi = roi, .th = 32, .tw = 40};
+    TEST_ASSERT_EQUAL(0, jpeg_convert(out, jpeg_sample_444, jpeg_sample_444_len, &config, &decoder));
+    TEST_ASSERT_EQUAL(2, decoder.scale);
+    TEST_ASSERT_EQUAL(roi.x, config.transform.x0);
+    TEST_ASSERT_EQUAL(roi.y, config.transform.y0);
+    TEST_ASSERT_EQUAL(roi.x + roi.w / 2, isp_source_x(&config.transform, 20));
+    TEST_ASSERT_EQUAL(roi.y + roi.h / 2, isp_source_y(&config.transform, 16));
+    // the caller's config is left as it was
+    TEST_ASSERT_EQUAL(0, config.h);
+    TEST_ASSERT_EQUAL(0, config.w);
+    TEST_ASSERT_EQUAL(roi.x, config.roi.x);
+    TEST_ASSERT_EQUAL(roi.w, config.roi.w);
+
+    pattern_box(ref, pattern, SAMPLE_W, 3, roi.y, roi.x, roi.h, roi.w, 2);
+    float err = mean_error(out, ref, 32 * 40 * 3);
+    printf("4:4:4 roi at 1/2: mean error %.2f\n", err);
+    TEST_ASSERT_LESS_THAN(3.0f, err);
+
+    isp_release(&config);
+    jpeg_release(&decoder);
+    free(pattern);
+    free(ref);
+    free(out);
+}
+
+TEST_CASE("jpeg rejects corrupt and unsupported streams", "[jpeg]")
+{
+    uint8_t *copy = malloc(jpeg_sample_420_len);
+    uint8_t out[24 * 32 * 3];
+    jpeg_decoder_t decoder = {0};
+    isp_config_t config = {.channels = 3, .th = 24, .tw = 32};
+    TEST_ASSERT_NOT_NULL(copy);
+
+    // no SOI
+    TEST_ASSERT_EQUAL(-1, jpeg_convert(out, jpeg_sample_420 + 2, jpeg_sample_420_len - 2, &config, &decoder));
+    // cut inside the headers
+    TEST_ASSERT_EQUAL(-1, jpeg_convert(out, jpeg_sample_420, 100, &config, &decoder));
+
+    // the same frame marked progressive
+    memcpy(copy, jpeg_sample_420, jpeg_sample_420_len);
+    for (unsigned int i = 2; i + 1 < jpeg_sample_420_len; i++)
+    {
+        if (copy[i] == 0xFF && copy[i + 1] == 0xC0)
+        {
+            copy[i + 1] = 0xC2;
+            break;
+        }
+    }
+    TEST_ASSERT_EQUAL(-1, jpeg_convert(out, copy, jpeg_sample_420_len, &config, &decoder));
+
+    // 16-bit quantization steps make coefficients no 8-bit frame has, they saturate instead of overflowing the IDCT
+    uint8_t *wide = malloc(jpeg_sample_420_len + 4 * 64);
+    uint8_t *full = malloc(SAMPLE_H * SAMPLE_W * 3);
+    TEST_ASSERT_NOT_NULL(wide);
+    TEST_ASSERT_NOT_NULL(full);
+    size_t wide_len = wide_quant(wide, jpeg_sample_420, jpeg_sample_420_len, 0xFFFF);
+    isp_config_t scaled = {.channels = 3, .th = SAMPLE_H, .tw = SAMPLE_W};
+    TEST_ASSERT_EQUAL(0, jpeg_convert(full, wide, wide_len, &scaled, &decoder));
+    isp_release(&scaled);
+    free(full);
+    free(wide);
+
+    // magnitudes beyond the 10 bits of a baseline AC coefficient
+    memcpy(copy, jpeg_sample_420, jpeg_sample_420_len);
+    edit_segments(copy, jpeg_sample_420_len, 0xC4, long_ac);
+    TEST_ASSERT_EQUAL(-1, jpeg_convert(out, copy, jpeg_sample_420_len, &config, &decoder));
+
+    // truncated entropy data still decodes, the missing part comes out flat
+    TEST_ASSERT_EQUAL(0, jpeg_convert(out, jpeg_sample_420, jpeg_sample_420_len / 2, &config, &decoder));
+
+    isp_release(&config);
+    jpeg_release(&decoder);
+    free(copy);
+}
+
+TEST_CASE("jpeg decode throughput", "[jpeg][performance]")
+{
+    const int rounds = 20, h = 240, w = 320, th = 96, tw = 96;
+    uint8_t *pattern = malloc(h * w * 3);
+    uint8_t *rgb565 = malloc(h * w * 2);
+    int8_t *dst = malloc(th * tw * 3);
+    int8_t qtable[256];
+    TEST_ASSERT_NOT_NULL(pattern);
+    TEST_ASSERT_NOT_NULL(rgb565);
+    TEST_ASSERT_NOT_NULL(dst);
+    isp_quant_table(qtable, 1.0f / 255, -128);
+
+    // the same frame as the camera would send it raw
+    fill_rgb888_pattern(pattern, h, w);
+    for (int i = 0; i < h * w; i++)
+    {
+        uint16_t v = (pattern[i * 3] >> 3) << 11 | (pattern[i * 3 + 1] >> 2) << 5 | pattern[i * 3 + 2] >> 3;
+        rgb565[i * 2] = v >> 8;
+        rgb565[i * 2 + 1] = v & 0xFF;
+    }
+
+    for (uint8_t channels = 1; channels <= 3; channels += 2)
+    {
+        jpeg_decoder_t decoder = {0};
+        isp_config_t jpeg_config = {.channels = channels, .filter = ISP_FILTER_AREA, .th = th, .tw = tw, .qtable = qtable};
+        isp_config_t raw_config = {.format = ISP_FORMAT_RGB565, .channels = channels, .filter = ISP_FILTER_AREA, .h = h, .w = w, .th = th, .tw = tw, .qtable = qtable};
+
+        TEST_ASSERT_EQUAL(0, jpeg_convert(dst, jpeg_sample_qvga, jpeg_sample_qvga_len, &jpeg_config, &decoder));
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++)
+        {
+            jpeg_convert(dst, jpeg_sample_qvga, jpeg_sample_qvga_len, &jpeg_config, &decoder);
+        }
+        clock_t mid = clock();
+        isp_convert(dst, rgb565, &raw_config);
+        for (int r = 0; r < rounds; r++)
+        {
+            isp_convert(dst, rgb565, &raw_config);
+        }
+        clock_t end = clock();
+        printf("%dx%d -> %dx%d int8 %s: jpeg (%u bytes, 1/%d) %.3f ms/frame, rgb565 (%d bytes) %.3f ms/frame\n", w, h, tw, th,
+               channels == 1 ? "gray" : "rgb", jpeg_sample_qvga_len, decoder.scale, (mid - start) * 1000.0 / CLOCKS_PER_SEC / rounds,
+               h * w * 2, (end - mid) * 1000.0 / CLOCKS_PER_SEC / rounds);
+
+        isp_release(&jpeg_config);
+        isp_release(&raw_config);
+        jpeg_release(&decoder);
+    }
+    free(pattern);
+    free(rgb565);
+    free(dst);
+}
@@ -0,0 +1,402 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+#include "pipeline.hpp"
+#include "pipeline_stub.hpp"
+#include "isp.h"
+
+#define SRC_H 240
+#define SRC_W 320
+#define DST_H 96
+#define DST_W 96
+
+using namespace pipeline;
+
+namespace
+{
+    void busy_wait(uint32_t us)
+    {
+        int64_t end = now() + us;
+        while (now() < end)
+        {
+        }
+    }
+
+    /* a model whose stages only take time, converting the frame like a vision model */
+    class StubModel : public Model
+    {
+    public:
+        StubModel(uint32_t invoke_us, uint32_t postprocess_us, uint8_t nslots = 1)
+            : invoke_us(invoke_us), postprocess_us(postprocess_us), processed(0), invoked(0), skip_every(0),
+              last(-1), out_of_order(0), shared(0), nslots(nslots), busy{}
+        {
+            // the inputs of both slots would not fit the stack of the test task
+            input = (int8_t *)malloc(2 * kInputSize);
+            isp_quant_table(qtable, 1.0f / 255, -128);
+            memset(&config, 0, sizeof(config));
+            config.format = ISP_FORMAT_RGB565;
+            config.channels = 3;
+            config.rotation = ROTATION_UP;
+            config.filter = ISP_FILTER_AREA;
+            config.parallel = isp_worker_init() == 0;
+            config.th = DST_H;
+            config.tw = DST_W;
+            config.qtable = qtable;
+        }
+
+        ~StubModel() override
+        {
+            isp_release(&config);
+            free(input);
+        }
+
+        uint8_t slots() const override { return nslots; }
+
+        bool preprocess(Job &job) override
+        {
+            StubFrame *frame = (StubFrame *)job.frame;
+            if (busy[job.slot])
+            {
+                shared++;
+            }
+            busy[job.slot] = true;
+            if (skip_every && job.seq % skip_every)
+            {
+                job.skip = true;
+                return true;
+            }
+            config.h = frame->height;
+            config.w = frame->width;
+            return input && isp_convert(input + job.slot * kInputSize, frame->buf, &config) == 0;
+        }
+
+        bool invoke(Job &job) override
+        {
+            invoked = invoked + 1;
+            busy_wait(invoke_us);
+            return true;
+        }
+
+        void postprocess(Job &job) override
+        {
+            StubFrame *frame = (StubFrame *)job.frame;
+            if ((int64_t)frame->seq <= last)
+            {
+                out_of_order++;
+            }
+            last = frame->seq;
+            busy_wait(postprocess_us);
+            processed = processed + 1;
+            busy[job.slot] = false;
+        }
+
+        uint32_t invoke_us, postprocess_us;
+        volatile uint32_t processed;
+        volatile uint32_t invoked;
+        uint32_t skip_every; /* preprocess skips the invoke of all frames but every so many */
+        int64_t last;
+        uint32_t out_of_order;
+        uint32_t shared; /* jobs that took a slot still in flight */
+
+    private:
+        static const size_t kInputSize = DST_H * DST_W * 3;
+
+        uint8_t nslots;
+        volatile bool busy[2];
+        int8_t *input; /* kInputSize per slot */
+        int8_t qtable[256];
+        isp_config_t config;
+    };
+
+    /* release hook of a QueueSource, the frames go back to the camera they came from */
+    StubCamera *hooked;
+    volatile uint32_t hook_returns;
+
+    void return_frame(void *frame)
+    {
+        hook_returns = hook_returns + 1;
+        hooked->release(frame);
+    }
+
+    /* wait until the pipeline has put through n frames, false on timeout */
+    bool wait_frames(const Pipeline &algo, uint32_t n, uint32_t timeout_ms)
+    {
+        int64_t end = now() + timeout_ms * 1000LL;
+        while (algo.frames() + algo.failures() < n)
+        {
+            if (now() > end)
+            {
+                return false;
+            }
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+        return true;
+    }
+}
+
+TEST_CASE("pipeline passes every frame on once and in order", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 2);
+    StubLcd lcd(camera);
+    StubModel model(1000, 0);
+    Pipeline algo(model, camera, &lcd);
+
+    TEST_ASSERT_EQUAL(0, algo.start(default_config("test")));
+    TEST_ASSERT_TRUE(wait_frames(algo, 20, 5000));
+    algo.stop();
+
+    TEST_ASSERT_EQUAL(0, algo.failures());
+    TEST_ASSERT_EQUAL(algo.frames(), model.processed);
+    TEST_ASSERT_EQUAL(algo.frames(), lcd.shown());
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+    TEST_ASSERT_EQUAL(0, lcd.reordered());
+    TEST_ASSERT_EQUAL(0, model.out_of_order);
+}
+
+TEST_CASE("pipelined jobs never share a slot", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 3);
+    StubLcd lcd(camera);
+    StubModel model(2000, 500, 2);
+    Pipeline algo(model, camera, &lcd);
+
+    TEST_ASSERT_EQUAL(0, algo.start(pipelined_config("test")));
+    TEST_ASSERT_TRUE(wait_frames(algo, 30, 5000));
+    algo.stop();
+
+    TEST_ASSERT_EQUAL(0, model.shared);
+    TEST_ASSERT_EQUAL(0, model.out_of_order);
+    TEST_ASSERT_EQUAL(0, lcd.reordered());
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+}
+
+TEST_CASE("pipeline keeps the latest frame when the model falls behind", "[pipeline]")
+{
+    // a frame every 2 ms into a model that takes 10 ms a frame
+    StubCamera camera(SRC_W, SRC_H, 4, 2000);
+    StubLcd lcd(camera);
+    StubModel model(10000, 0);
+    Pipeline algo(model, camera, &lcd);
+    Config config = default_config("test");
+    config.policy = POLICY_LATEST_FRAME;
+
+    TEST_ASSERT_EQUAL(0, algo.start(config));
+    TEST_ASSERT_TRUE(wait_frames(algo, 10, 5000));
+    algo.stop();
+
+    Stats stats = algo.stats();
+    TEST_ASSERT_GREATER_THAN(0, stats.dropped);
+    TEST_ASSERT_EQUAL(camera.captured(), stats.frames + stats.dropped);
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+    TEST_ASSERT_EQUAL(0, lcd.reordered());
+}
+
+TEST_CASE("pipeline hands dropped frames back through the source's release hook", "[pipeline]")
+{
+    // the frames of a camera queue, like register_camera() fills, owned by a stub camera
+    StubCamera owner(SRC_W, SRC_H, 6);
+    QueueHandle_t frames = xQueueCreate(6, sizeof(void *));
+    for (int i = 0; i < 6; i++)
+    {
+        void *frame = owner.acquire(portMAX_DELAY);
+        xQueueSend(frames, &frame, portMAX_DELAY);
+    }
+    hooked = &owner;
+    hook_returns = 0;
+
+    QueueSource camera(frames, return_frame);
+    StubLcd lcd(camera);
+    StubModel model(1000, 0);
+    Pipeline algo(model, camera, &lcd);
+    Config config = default_config("test");
+    config.policy = POLICY_LATEST_FRAME;
+
+    // the first take finds the other five waiting and keeps only the newest of them
+    TEST_ASSERT_EQUAL(0, algo.start(config));
+    TEST_ASSERT_TRUE(wait_frames(algo, 1, 5000));
+    algo.stop();
+
+    Stats stats = algo.stats();
+    TEST_ASSERT_EQUAL(1, stats.frames);
+    TEST_ASSERT_EQUAL(5, stats.dropped);
+    TEST_ASSERT_EQUAL(6, hook_returns);
+    TEST_ASSERT_EQUAL(owner.captured(), owner.released());
+    vQueueDelete(frames);
+}
+
+TEST_CASE("pipeline counts stage latencies", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 2, 2000);
+    StubLcd lcd(camera);
+    StubModel model(3000, 1000);
+    Pipeline algo(model, camera, &lcd);
+
+    TEST_ASSERT_EQUAL(0, algo.start(default_config("test")));
+    TEST_ASSERT_TRUE(wait_frames(algo, 10, 5000));
+    algo.stop();
+
+    Stats stats = algo.stats();
+    TEST_ASSERT_EQUAL(0, stats.dropped);
+    TEST_ASSERT_EQUAL(stats.frames, stats.latency.count);
+    for (int i = 0; i < STAGE_COUNT; i++)
+    {
+        TEST_ASSERT_EQUAL(stats.frames, stats.run[i].count);
+        TEST_ASSERT_LESS_OR_EQUAL(stats.run[i].max, stats.run[i].mean());
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(3000, stats.run[STAGE_INVOKE].mean());
+    TEST_ASSERT_GREATER_OR_EQUAL(1000, stats.run[STAGE_POSTPROCESS].mean());
+    TEST_ASSERT_GREATER_OR_EQUAL(4000, stats.latency.mean());
+    algo.print_stats();
+}
+
+TEST_CASE("pipeline without a sink returns frames to the source", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 1);
+    StubModel model(0, 0);
+    Pipeline algo(model, camera);
+
+    TEST_ASSERT_EQUAL(0, algo.start(default_config("test")));
+    TEST_ASSERT_TRUE(wait_frames(algo, 10, 5000));
+    algo.stop();
+
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+    TEST_ASSERT_EQUAL(algo.frames(), camera.released());
+}
+
+TEST_CASE("pipeline pauses on the event queue and restarts after stop", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 2);
+    StubLcd lcd(camera);
+    StubModel model(0, 0);
+    Pipeline algo(model, camera, &lcd);
+    QueueHandle_t event = xQueueCreate(1, sizeof(bool));
+
+    TEST_ASSERT_EQUAL(0, algo.start(default_config("test"), event));
+    TEST_ASSERT_EQUAL(-1, algo.start(default_config("test"), event));
+    TEST_ASSERT_TRUE(wait_frames(algo, 5, 5000));
+
+    bool enable = false;
+    xQueueSend(event, &enable, portMAX_DELAY);
+    vTaskDelay(pdMS_TO_TICKS(50));
+    uint32_t paused = algo.frames();
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_EQUAL(paused, algo.frames());
+
+    enable = true;
+    xQueueSend(event, &enable, portMAX_DELAY);
+    TEST_ASSERT_TRUE(wait_frames(algo, paused + 5, 5000));
+    algo.stop();
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+
+    // a stopped pipeline starts over with fresh counters
+    TEST_ASSERT_EQUAL(0, algo.start(default_config("test")));
+    TEST_ASSERT_TRUE(wait_frames(algo, 5, 5000));
+    algo.stop();
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+    TEST_ASSERT_EQUAL(0, lcd.reordered());
+
+    vQueueDelete(event);
+}
+
+TEST_CASE("pipeline skips the invoke of frames the model passes over", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 3);
+    StubLcd lcd(camera);
+    StubModel model(1000, 0, 2);
+    model.skip_every = 4;
+    Pipeline algo(model, camera, &lcd);
+
+    TEST_ASSERT_EQUAL(0, algo.start(pipelined_config("test")));
+    TEST_ASSERT_TRUE(wait_frames(algo, 40, 5000));
+    algo.stop();
+
+    // skipped frames still go through postprocess, in order, and are counted
+    Stats stats = algo.stats();
+    TEST_ASSERT_EQUAL(stats.frames, model.processed);
+    TEST_ASSERT_EQUAL(stats.frames - (stats.frames + 3) / 4, stats.skipped);
+    TEST_ASSERT_EQUAL(stats.frames - stats.skipped, model.invoked);
+    TEST_ASSERT_EQUAL(0, lcd.reordered());
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+}
+
+TEST_CASE("pipeline takes single shots and leaves the source alone while paused", "[pipeline]")
+{
+    StubCamera camera(SRC_W, SRC_H, 2);
+    StubModel model(0, 0);
+    Pipeline algo(model, camera);
+    QueueHandle_t event = xQueueCreate(2, sizeof(uint8_t));
+
+    TEST_ASSERT_EQUAL(0, algo.start(default_config("test"), event, CONTROL_PAUSE));
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_TRUE(algo.paused());
+    TEST_ASSERT_EQUAL(0, camera.captured());
+
+    for (uint32_t shot = 1; shot <= 3; shot++)
+    {
+        uint8_t command = CONTROL_SINGLE_SHOT;
+        xQueueSend(event, &command, portMAX_DELAY);
+        TEST_ASSERT_TRUE(wait_frames(algo, shot, 5000));
+        vTaskDelay(pdMS_TO_TICKS(50));
+        TEST_ASSERT_EQUAL(shot, algo.frames());
+        TEST_ASSERT_EQUAL(shot, camera.captured());
+        TEST_ASSERT_TRUE(algo.paused());
+    }
+
+    // a shot while running takes the frame in hand and pauses
+    algo.control(CONTROL_RUN);
+    TEST_ASSERT_TRUE(wait_frames(algo, 10, 5000));
+    algo.control(CONTROL_SINGLE_SHOT);
+    vTaskDelay(pdMS_TO_TICKS(50));
+    uint32_t frames = algo.frames();
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_EQUAL(frames, algo.frames());
+    TEST_ASSERT_TRUE(algo.paused());
+
+    // stop() wakes a paused pipeline up
+    algo.stop();
+    TEST_ASSERT_EQUAL(camera.captured(), camera.released());
+    vQueueDelete(event);
+}
+
+TEST_CASE("pipeline throughput", "[pipeline][performance]")
+{
+    const int n = 50;
+    const uint32_t invoke_us = 5000, postprocess_us = 1000;
+    double ms[2];
+
+    for (int slots = 1; slots <= 2; slots++)
+    {
+        StubCamera camera(SRC_W, SRC_H, 3);
+        StubLcd lcd(camera);
+        StubModel model(invoke_us, postprocess_us, slots);
+        Pipeline algo(model, camera, &lcd);
+
+        int64_t start = now();
+        TEST_ASSERT_EQUAL(0, algo.start(slots == 1 ? default_config("test") : pipelined_config("test")));
+        TEST_ASSERT_TRUE(wait_frames(algo, n, 30000));
+        int64_t end = now();
+        algo.stop();
+        ms[slots - 1] = (end - start) / 1000.0 / n;
+    }
+
+    // what one task doing the stages back to back takes per frame
+    StubCamera camera(SRC_W, SRC_H, 1);
+    StubModel model(invoke_us, postprocess_us);
+    StubFrame *frame = (StubFrame *)camera.acquire(portMAX_DELAY);
+    Job job = {};
+    job.frame = frame;
+    int64_t start = now();
+    for (int i = 0; i < n; i++)
+    {
+        model.preprocess(job);
+        model.invoke(job);
+        busy_wait(postprocess_us);
+    }
+    int64_t end = now();
+    camera.release(frame);
+
+    printf("%dx%d rgb565 -> %dx%d int8, %u us invoke: serial %.2f ms/frame, one slot %.2f ms/frame, two slots %.2f ms/frame\n",
+           SRC_W, SRC_H, DST_W, DST_H, (unsigned)invoke_us, (end - start) / 1000.0 / n, ms[0], ms[1]);
+}
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+#include "track.h"
+
+#define MIN_HITS 3
+#define MAX_AGE 2
+
+static detect_box_t box_at(int x, int y, int w, int h, uint8_t target)
+{
+    detect_box_t box = {(uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, 80, target};
+    return box;
+}
+
+static const track_object_t *find_id(const track_object_t *objects, int n, uint16_t id)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if (objects[i].id == id)
+        {
+            return &objects[i];
+        }
+    }
+    return NULL;
+}
+
+TEST_CASE("track keeps the ids of objects moving at constant speed", "[track]")
+{
+    static tracker_t tracker;
+    track_object_t out[TRACK_MAX];
+    const int vx[] = {3, -2, 0}, vy[] = {1, 2, -4};
+    uint16_t ids[3] = {0};
+    srand(3);
+    tracker_init(&tracker, MIN_HITS, MAX_AGE, 30, TRACK_GREEDY);
+
+    for (int f = 0; f < 30; f++)
+    {
+        detect_box_t boxes[3];
+        for (int o = 0; o < 3; o++)
+        {
+            // a pixel of detector noise
+            boxes[o] = box_at(60 + o * 100 + vx[o] * f + rand() % 3 - 1, 150 + vy[o] * f + rand() % 3 - 1, 40, 60, o);
+        }
+        int n = tracker_update(&tracker, boxes, 3, out, TRACK_MAX);
+        // reported from the min_hits-th detection on, with the same id ever after
+        TEST_ASSERT_EQUAL(f + 1 < MIN_HITS ? 0 : 3, n);
+        for (int i = 0; i < n; i++)
+        {
+            int o = out[i].box.target;
+            ids[o] = ids[o] ? ids[o] : out[i].id;
+            TEST_ASSERT_EQUAL(ids[o], out[i].id);
+        }
+        TEST_ASSERT_EQUAL(f + 1 >= MIN_HITS, tracker_stable(&tracker));
+    }
+    TEST_ASSERT_TRUE(ids[0] != ids[1] && ids[1] != ids[2] && ids[0] != ids[2]);
+
+    // without the detector, the boxes go on at the speed learned
+    for (int f = 30; f < 36; f++)
+    {
+        TEST_ASSERT_EQUAL(3, tracker_predict(&tracker, out, TRACK_MAX));
+        for (int o = 0; o < 3; o++)
+        {
+            const track_object_t *object = find_id(out, 3, ids[o]);
+            TEST_ASSERT_NOT_NULL(object);
+            TEST_ASSERT_INT_WITHIN(3, 60 + o * 100 + vx[o] * f, object->box.x);
+            TEST_ASSERT_INT_WITHIN(3, 150 + vy[o] * f, object->box.y);
+            TEST_ASSERT_INT_WITHIN(2, 40, object->box.w);
+            TEST_ASSERT_INT_WITHIN(2, 60, object->box.h);
+        }
+    }
+}
+
+TEST_CASE("track retires lost objects and numbers new ones", "[track]")
+{
+    static tracker_t tracker;
+    track_object_t out[TRACK_MAX];
+    detect_box_t boxes[2] = {box_at(50, 50, 30, 30, 0), box_at(150, 50, 30, 30, 0)};
+    tracker_init(&tracker, 1, MAX_AGE, 30, TRACK_HUNGARIAN);
+
+    TEST_ASSERT_EQUAL(2, tracker_update(&tracker, boxes, 2, out, TRACK_MAX));
+    uint16_t first = out[0].id, second = out[1].id;
+
+    // the second one goes missing, its track waits max_age detector frames and goes
+    for (int f = 0; f < MAX_AGE; f++)
+    {
+        TEST_ASSERT_EQUAL(1, tracker_update(&tracker, boxes, 1, out, TRACK_MAX));
+        TEST_ASSERT_EQUAL(first, out[0].id);
+        TEST_ASSERT_EQUAL(2, tracker.count);
+        TEST_ASSERT_FALSE(tracker_stable(&tracker));
+    }
+    TEST_ASSERT_EQUAL(1, tracker_update(&tracker, boxes, 1, out, TRACK_MAX));
+    TEST_ASSERT_EQUAL(1, tracker.count);
+    TEST_ASSERT_TRUE(tracker_stable(&tracker));
+
+    // back again, a new object
+    TEST_ASSERT_EQUAL(2, tracker_update(&tracker, boxes, 2, out, TRACK_MAX));
+    TEST_ASSERT_EQUAL(first, out[0].id);
+    TEST_ASSERT_TRUE(out[1].id != first && out[1].id != second);
+
+    // an object of another class in the same place is another object
+    boxes[1] = box_at(50, 50, 30, 30, 1);
+    TEST_ASSERT_EQUAL(2, tracker_update(&tracker, boxes, 2, out, TRACK_MAX));
+    TEST_ASSERT_EQUAL(3, tracker.count);
+
+    // full: the detections beyond TRACK_MAX tracks start none
+    detect_box_t many[TRACK_MAX + 4];
+    for (int i = 0; i < TRACK_MAX + 4; i++)
+    {
+        many[i] = box_at(20 + (i % 8) * 40, 20 + (i / 8) * 40, 10, 10, 2);
+    }
+    tracker_reset(&tracker);
+    TEST_ASSERT_EQUAL(TRACK_MAX, tracker_update(&tracker, many, TRACK_MAX + 4, out, TRACK_MAX));
+}
+
+TEST_CASE("track hungarian matches what greedy leaves apart", "[track]")
+{
+    static tracker_t tracker;
+    track_object_t out[TRACK_MAX];
+    // A at 100 and B at 70, then two detections: greedy gives A the nearest one and B nothing,
+    // the best assignment shifts A to the other detection so B keeps its own
+    detect_box_t tracks[2] = {box_at(100, 100, 40, 40, 0), box_at(70, 100, 40, 40, 0)};
+    detect_box_t boxes[2] = {box_at(90, 100, 40, 40, 0), box_at(112, 100, 40, 40, 0)};
+
+    for (int assign = TRACK_GREEDY; assign <= TRACK_HUNGARIAN; assign++)
+    {
+        tracker_init(&tracker, 1, MAX_AGE, 30, (track_assign_t)assign);
+        TEST_ASSERT_EQUAL(2, tracker_update(&tracker, tracks, 2, out, TRACK_MAX));
+        uint16_t a = out[0].id, b = out[1].id;
+
+        int n = tracker_update(&tracker, boxes, 2, out, TRACK_MAX);
+        if (assign == TRACK_GREEDY)
+        {
+            // B missed, the second detection starts a third track
+            TEST_ASSERT_EQUAL(3, tracker.count);
+            TEST_ASSERT_EQUAL(2, n);
+            TEST_ASSERT_NOT_NULL(find_id(out, n, a));
+            TEST_ASSERT_NULL(find_id(out, n, b));
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(2, tracker.count);
+            TEST_ASSERT_EQUAL(2, n);
+            TEST_ASSERT_TRUE(find_id(out, n, a)->box.x > 100);
+            TEST_ASSERT_TRUE(find_id(out, n, b)->box.x < 90);
+        }
+    }
+}
+
+TEST_CASE("track hungarian finds the assignment of most overlap", "[track]")
+{
+    static tracker_t tracker;
+    track_object_t out[TRACK_MAX];
+    srand(17);
+    for (int round = 0; round < 200; round++)
+    {
+        // a few tracks and detections close together, every assignment is a permutation of 5
+        detect_box_t tracks[5], boxes[5];
+        for (int i = 0; i < 5; i++)
+        {
+            tracks[i] = box_at(100 + rand() % 40, 100 + rand() % 40, 30 + rand() % 20, 30 + rand() % 20, 0);
+            boxes[i] = box_at(100 + rand() % 40, 100 + rand() % 40, 30 + rand() % 20, 30 + rand() % 20, 0);
+        }
+        tracker_init(&tracker, 1, MAX_AGE, 0, TRACK_HUNGARIAN);
+        tracker_update(&tracker, tracks, 5, out, TRACK_MAX);
+        tracker_update(&tracker, boxes, 5, out, TRACK_MAX);
+
+        // the overlap the tracker matched on, against every permutation
+        uint32_t matched = 0;
+        for (int t = 0; t < 5; t++)
+        {
+            matched += tracker.match[t] >= 0 ? tracker.overlap[t][tracker.match[t]] : 0;
+        }
+        uint32_t best = 0;
+        int perm[5] = {0, 1, 2, 3, 4};
+        for (int k = 0; k < 120; k++)
+        {
+            uint32_t sum = 0;
+            for (int t = 0; t < 5; t++)
+            {
+                sum += tracker.overlap[t][perm[t]];
+            }
+            best = sum > best ? sum : best;
+            // next permutation
+            int i = 3;
+            while (i >= 0 && perm[i] > perm[i + 1])
+            {
+                i--;
+            }
+            if (i < 0)
+            {
+                break;
+            }
+            int j = 4;
+            while (perm[j] < perm[i])
+            {
+                j--;
+            }
+            int t = perm[i];
+            perm[i] = perm[j];
+            perm[j] = t;
+            for (int l = i + 1, r = 4; l < r; l++, r--)
+            {
+                t = perm[l];
+                perm[l] = perm[r];
+                perm[r] = t;
+            }
+        }
+        TEST_ASSERT_EQUAL(best, matched);
+    }
+}
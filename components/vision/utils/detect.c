@@ -0,0 +1,518 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      detect.c
+* @brief     YOLO output decoding and NMS without allocation
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#include <stdbool.h>
+#include <string.h>
+#include "detect.h"
+
+#define CLIP(x, y, z) ((x) < (y) ? (y) : ((x) > (z) ? (z) : (x)))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* true if a goes before b */
+typedef bool (*detect_order_t)(const detect_box_t *a, const detect_box_t *b);
+
+static bool detect_more_confident(const detect_box_t *a, const detect_box_t *b)
+{
+    if (a->confidence != b->confidence)
+    {
+        return a->confidence > b->confidence;
+    }
+    // a fixed order for ties, whatever order the rows came in
+    if (a->y != b->y)
+    {
+        return a->y < b->y;
+    }
+    if (a->x != b->x)
+    {
+        return a->x < b->x;
+    }
+    if (a->w != b->w)
+    {
+        return a->w < b->w;
+    }
+    if (a->h != b->h)
+    {
+        return a->h < b->h;
+    }
+    return a->target < b->target;
+}
+
+static bool detect_further_right(const detect_box_t *a, const detect_box_t *b)
+{
+    return a->x != b->x ? a->x > b->x : detect_more_confident(a, b);
+}
+
+static inline void detect_swap(detect_box_t *a, detect_box_t *b)
+{
+    detect_box_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+/* the heap root is the box that goes last: the one to evict, or to move to the end when sorting */
+static void detect_sift_down(detect_box_t *heap, size_t n, size_t i, detect_order_t before)
+{
+    while (true)
+    {
+        size_t last = i;
+        size_t l = 2 * i + 1;
+        size_t r = l + 1;
+        if (l < n && before(&heap[last], &heap[l]))
+        {
+            last = l;
+        }
+        if (r < n && before(&heap[last], &heap[r]))
+        {
+            last = r;
+        }
+        if (last == i)
+        {
+            return;
+        }
+        detect_swap(&heap[i], &heap[last]);
+        i = last;
+    }
+}
+
+static void detect_sift_up(detect_box_t *heap, size_t i, detect_order_t before)
+{
+    while (i > 0)
+    {
+        size_t parent = (i - 1) / 2;
+        if (!before(&heap[parent], &heap[i]))
+        {
+            return;
+        }
+        detect_swap(&heap[parent], &heap[i]);
+        i = parent;
+    }
+}
+
+/* in place, no allocation and n log n at worst */
+static void detect_sort(detect_box_t *boxes, size_t n, detect_order_t before, bool heap)
+{
+    if (!heap)
+    {
+        for (size_t i = n / 2; i-- > 0;)
+        {
+            detect_sift_down(boxes, n, i, before);
+        }
+    }
+    for (size_t i = n; i-- > 1;)
+    {
+        detect_swap(&boxes[0], &boxes[i]);
+        detect_sift_down(boxes, i, 0, before);
+    }
+}
+
+/* keep the top_n most confident boxes of a class in a bounded min-heap */
+static void detect_push(detect_box_t *heap, uint16_t *count, uint16_t top_n, const detect_box_t *box)
+{
+    if (*count < top_n)
+    {
+        heap[*count] = *box;
+        detect_sift_up(heap, (*count)++, detect_more_confident);
+    }
+    else if (top_n && detect_more_confident(box, &heap[0]))
+    {
+        heap[0] = *box;
+        detect_sift_down(heap, top_n, 0, detect_more_confident);
+    }
+}
+
+/* 4x the intersection of a and b, with the union of the same scale in *area */
+static uint64_t detect_intersection(const detect_box_t *a, const detect_box_t *b, uint64_t *area)
+{
+    int32_t iw = MIN(2 * a->x + a->w, 2 * b->x + b->w) - MAX(2 * a->x - a->w, 2 * b->x - b->w);
+    int32_t ih = MIN(2 * a->y + a->h, 2 * b->y + b->h) - MAX(2 * a->y - a->h, 2 * b->y - b->h);
+    if (iw <= 0 || ih <= 0)
+    {
+        return 0;
+    }
+    uint64_t inter = (uint64_t)iw * (uint64_t)ih;
+    *area = 4 * ((uint64_t)a->w * a->h + (uint64_t)b->w * b->h) - inter;
+    return inter;
+}
+
+bool detect_iou_at_least(const detect_box_t *a, const detect_box_t *b, uint8_t iou)
+{
+    uint64_t area = 0;
+    uint64_t inter = detect_intersection(a, b, &area);
+    return inter && inter * 100 >= iou * area;
+}
+
+uint16_t detect_iou_q15(const detect_box_t *a, const detect_box_t *b)
+{
+    uint64_t area = 0;
+    uint64_t inter = detect_intersection(a, b, &area);
+    return inter ? (uint16_t)((inter << 15) / area) : 0;
+}
+
+/* exp(-k / 8) in Q15 */
+static const uint16_t exp_neg_table[65] = {
+    32767, 28918, 25520, 22521, 19875, 17539, 15479, 13660,
+    12055, 10638, 9388, 8285, 7312, 6452, 5694, 5025,
+    4435, 3914, 3454, 3048, 2690, 2374, 2095, 1849,
+    1631, 1440, 1271, 1121, 990, 873, 771, 680,
+    600, 530, 467, 412, 364, 321, 283, 250,
+    221, 195, 172, 152, 134, 118, 104, 92,
+    81, 72, 63, 56, 49, 43, 38, 34,
+    30, 26, 23, 21, 18, 16, 14, 12,
+    11};
+
+uint16_t detect_exp_neg_q15(uint32_t x)
+{
+    uint32_t k = x >> 12;
+    if (k >= 64)
+    {
+        return 0;
+    }
+    uint32_t frac = x & 0xFFF;
+    return (uint16_t)(exp_neg_table[k] - (((exp_neg_table[k] - exp_neg_table[k + 1]) * frac) >> 12));
+}
+
+/* greedy NMS over boxes sorted by confidence, the kept ones are packed at the front */
+static uint16_t detect_suppress(detect_box_t *boxes, uint16_t n, uint8_t iou)
+{
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        bool keep = true;
+        for (uint16_t j = 0; j < kept && keep; j++)
+        {
+            keep = !detect_iou_at_least(&boxes[j], &boxes[i], iou);
+        }
+        if (keep)
+        {
+            boxes[kept++] = boxes[i];
+        }
+    }
+    return kept;
+}
+
+/*
+ * The same greedy NMS with the kept boxes bucketed by centre in a grid
+ * whose cells are at least as large as the largest box: two boxes that
+ * overlap are less than a cell apart, so a box only has to be compared
+ * with the kept boxes of its cell and the 8 around it.
+ */
+static uint16_t detect_suppress_binned(detect_box_t *boxes, uint16_t n, uint8_t iou, detect_workspace_t *ws,
+                                       uint16_t width, uint16_t height)
+{
+    uint16_t extent = 1;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        extent = MAX(extent, MAX(boxes[i].w, boxes[i].h));
+    }
+    const int cols = CLIP(width / extent, 1, DETECT_GRID_MAX);
+    const int rows = CLIP(height / extent, 1, DETECT_GRID_MAX);
+    const int cw = (width + cols - 1) / cols;
+    const int ch = (height + rows - 1) / rows;
+    for (int c = 0; c < cols * rows; c++)
+    {
+        ws->cells[c] = -1;
+    }
+
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        const int cx = MIN(boxes[i].x / cw, cols - 1);
+        const int cy = MIN(boxes[i].y / ch, rows - 1);
+        bool keep = true;
+        for (int y = MAX(cy - 1, 0); y <= MIN(cy + 1, rows - 1) && keep; y++)
+        {
+            for (int x = MAX(cx - 1, 0); x <= MIN(cx + 1, cols - 1) && keep; x++)
+            {
+                for (int16_t j = ws->cells[y * cols + x]; j >= 0 && keep; j = ws->next[j])
+                {
+                    keep = !detect_iou_at_least(&boxes[j], &boxes[i], iou);
+                }
+            }
+        }
+        if (keep)
+        {
+            boxes[kept] = boxes[i];
+            ws->next[kept] = ws->cells[cy * cols + cx];
+            ws->cells[cy * cols + cx] = (int16_t)kept;
+            kept++;
+        }
+    }
+    return kept;
+}
+
+/*
+ * Soft-NMS over boxes sorted by confidence: the most confident box left is
+ * kept and decays the confidence of those it overlaps, until the best one
+ * left is under the threshold. Confidences are % in Q8, decays Q15.
+ */
+static uint16_t detect_suppress_soft(detect_box_t *boxes, uint16_t n, const detect_config_t *config, uint16_t *scores)
+{
+    const uint16_t threshold = (uint16_t)config->threshold << 8;
+    const uint32_t sigma = config->sigma ? config->sigma : 1;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        scores[i] = (uint16_t)boxes[i].confidence << 8;
+    }
+
+    uint16_t kept = 0;
+    for (; kept < n; kept++)
+    {
+        uint16_t best = kept;
+        for (uint16_t j = kept + 1; j < n; j++)
+        {
+            // ties go the way of the sort, whatever the swaps did to the order
+            if (scores[j] > scores[best] || (scores[j] == scores[best] && detect_more_confident(&boxes[j], &boxes[best])))
+            {
+                best = j;
+            }
+        }
+        if (scores[best] < threshold)
+        {
+            break;
+        }
+        detect_swap(&boxes[kept], &boxes[best]);
+        uint16_t score = scores[best];
+        scores[best] = scores[kept];
+        boxes[kept].confidence = (uint8_t)(score >> 8);
+
+        for (uint16_t j = kept + 1; j < n; j++)
+        {
+            uint32_t iou = detect_iou_q15(&boxes[kept], &boxes[j]);
+            uint32_t decay;
+            if (iou == 0)
+            {
+                continue;
+            }
+            if (config->nms == DETECT_NMS_LINEAR)
+            {
+                if (iou * 100 < (uint32_t)config->iou << 15)
+                {
+                    continue;
+                }
+                decay = 32768 - iou;
+            }
+            else
+            {
+                decay = detect_exp_neg_q15((uint32_t)(((uint64_t)iou * iou >> 15) * 100 / sigma));
+            }
+            scores[j] = (uint16_t)((scores[j] * decay) >> 15);
+        }
+    }
+    return kept;
+}
+
+static uint16_t detect_nms(detect_box_t *boxes, uint16_t n, const detect_config_t *config, detect_workspace_t *ws)
+{
+    if (config->nms != DETECT_NMS_HARD)
+    {
+        return detect_suppress_soft(boxes, n, config, ws->scores);
+    }
+    return config->binned ? detect_suppress_binned(boxes, n, config->iou, ws, config->width, config->height)
+                          : detect_suppress(boxes, n, config->iou);
+}
+
+size_t detect_workspace_size(uint16_t num_class, uint16_t top_n)
+{
+    size_t candidates = (size_t)num_class * top_n;
+    return candidates * (sizeof(detect_box_t) + sizeof(int16_t) + sizeof(uint16_t)) + num_class * sizeof(uint16_t) +
+           DETECT_GRID_MAX * DETECT_GRID_MAX * sizeof(int16_t);
+}
+
+int detect_workspace_init(detect_workspace_t *ws, void *buffer, size_t size, uint16_t num_class, uint16_t top_n)
+{
+    size_t candidates = (size_t)num_class * top_n;
+    if (buffer == NULL || size < detect_workspace_size(num_class, top_n) || candidates > INT16_MAX)
+    {
+        return -1;
+    }
+    ws->boxes = (detect_box_t *)buffer;
+    ws->counts = (uint16_t *)(ws->boxes + candidates);
+    ws->next = (int16_t *)(ws->counts + num_class);
+    ws->scores = (uint16_t *)(ws->next + candidates);
+    ws->cells = (int16_t *)(ws->scores + candidates);
+    ws->num_class = num_class;
+    ws->top_n = top_n;
+    return 0;
+}
+
+/* objectness of a row in %, as compared with the threshold */
+static float detect_confidence(const detect_config_t *config, int8_t q)
+{
+    float confidence = (float)(q - config->zero_point) * config->scale;
+    // quantized as 0..1 rather than pixels and %
+    return config->scale < 0.1f ? confidence * 100 : confidence;
+}
+
+/* decode a row that passed the threshold into the heap of its class */
+static void detect_candidate(const int8_t *row, float confidence, const detect_config_t *config, detect_workspace_t *ws)
+{
+    const int zero_point = config->zero_point;
+    const float scale = config->scale;
+    const uint16_t width = config->width;
+    const uint16_t height = config->height;
+
+    detect_box_t box;
+    int8_t max = -128;
+    box.target = 0;
+    for (int j = 0; j < config->num_class; j++)
+    {
+        if (max < row[DETECT_T_INDEX + j])
+        {
+            max = row[DETECT_T_INDEX + j];
+            box.target = j;
+        }
+    }
+
+    float x = (float)(row[DETECT_X_INDEX] - zero_point) * scale;
+    float y = (float)(row[DETECT_Y_INDEX] - zero_point) * scale;
+    float w = (float)(row[DETECT_W_INDEX] - zero_point) * scale;
+    float h = (float)(row[DETECT_H_INDEX] - zero_point) * scale;
+    if (scale < 0.1f)
+    {
+        x *= width;
+        y *= height;
+        w *= width;
+        h *= height;
+    }
+    box.x = CLIP((int)x, 0, width);
+    box.y = CLIP((int)y, 0, height);
+    box.w = CLIP((int)w, 0, width);
+    box.h = CLIP((int)h, 0, height);
+    box.w = (box.x + box.w) > width ? (width - box.x) : box.w;
+    box.h = (box.y + box.h) > height ? (height - box.y) : box.h;
+    box.confidence = (uint8_t)CLIP((int)confidence, 0, 255);
+
+    detect_push(ws->boxes + box.target * ws->top_n, &ws->counts[box.target], ws->top_n, &box);
+}
+
+void detect_prepare(detect_config_t *config)
+{
+    // the dequantized objectness only grows with the byte, the first one to pass sets the bar
+    config->threshold_q = 128;
+    for (int q = -128; q <= 127; q++)
+    {
+        if ((int)detect_confidence(config, (int8_t)q) >= config->threshold)
+        {
+            config->threshold_q = (int16_t)q;
+            break;
+        }
+    }
+    config->decode = DETECT_DECODE_QUANTIZED;
+}
+
+/* rows whose objectness byte reaches the threshold, blocks of background rows cost one compare */
+static void detect_scan_quantized(const int8_t *output, const detect_config_t *config, detect_workspace_t *ws)
+{
+    const int stride = config->num_class + DETECT_T_INDEX;
+    const int n = config->num_record;
+    const int16_t threshold = config->threshold_q;
+    const int8_t *c = output + DETECT_C_INDEX;
+    int i = 0;
+
+    // rows are interleaved, so no wide load: the max of 8 objectness bytes, without branches, rejects all 8
+    for (; i + 8 <= n; i += 8)
+    {
+        const int8_t *p = c + i * stride;
+        int8_t m0 = MAX(p[0], p[stride]);
+        int8_t m1 = MAX(p[2 * stride], p[3 * stride]);
+        int8_t m2 = MAX(p[4 * stride], p[5 * stride]);
+        int8_t m3 = MAX(p[6 * stride], p[7 * stride]);
+        if (MAX(MAX(m0, m1), MAX(m2, m3)) < threshold)
+        {
+            continue;
+        }
+        for (int k = 0; k < 8; k++)
+        {
+            if (p[k * stride] >= threshold)
+            {
+                detect_candidate(output + (i + k) * stride, detect_confidence(config, p[k * stride]), config, ws);
+            }
+        }
+    }
+    for (; i < n; i++)
+    {
+        if (c[i * stride] >= threshold)
+        {
+            detect_candidate(output + i * stride, detect_confidence(config, c[i * stride]), config, ws);
+        }
+    }
+}
+
+int detect_yolo(const int8_t *output, const detect_config_t *config, detect_workspace_t *ws,
+                detect_box_t *out, int max_out, int *found)
+{
+    const int num_class = config->num_class;
+    const int num_element = num_class + DETECT_T_INDEX;
+
+    if (num_class <= 0 || num_class > ws->num_class)
+    {
+        return -1;
+    }
+    memset(ws->counts, 0, num_class * sizeof(uint16_t));
+
+    if (config->decode == DETECT_DECODE_QUANTIZED)
+    {
+        detect_scan_quantized(output, config, ws);
+    }
+    else
+    {
+        for (int i = 0; i < config->num_record; i++)
+        {
+            const int8_t *row = output + i * num_element;
+            float confidence = detect_confidence(config, row[DETECT_C_INDEX]);
+            if ((int)confidence >= config->threshold)
+            {
+                detect_candidate(row, confidence, config, ws);
+            }
+        }
+    }
+
+    uint32_t total = 0;
+    if (config->agnostic)
+    {
+        // every class in one list, then one pass over all of them
+        for (int c = 0; c < num_class; c++)
+        {
+            memmove(ws->boxes + total, ws->boxes + c * ws->top_n, ws->counts[c] * sizeof(detect_box_t));
+            total += ws->counts[c];
+        }
+        detect_sort(ws->boxes, total, detect_more_confident, false);
+        total = detect_nms(ws->boxes, total, config, ws);
+    }
+    else
+    {
+        // per class: sort the heap, suppress, then pack what is left at the front of the workspace
+        for (int c = 0; c < num_class; c++)
+        {
+            detect_box_t *boxes = ws->boxes + c * ws->top_n;
+            detect_sort(boxes, ws->counts[c], detect_more_confident, true);
+            uint16_t kept = detect_nms(boxes, ws->counts[c], config, ws);
+            memmove(ws->boxes + total, boxes, kept * sizeof(detect_box_t));
+            total += kept;
+        }
+    }
+
+    if (found)
+    {
+        *found = (int)total;
+    }
+    max_out = max_out < 0 ? 0 : max_out;
+    if (total > (uint32_t)max_out)
+    {
+        detect_sort(ws->boxes, total, detect_more_confident, false);
+        total = max_out;
+    }
+    memcpy(out, ws->boxes, total * sizeof(detect_box_t));
+    detect_sort(out, total, detect_further_right, false);
+    return (int)total;
+}
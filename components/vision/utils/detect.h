@@ -0,0 +1,158 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      detect.h
+* @brief     YOLO output decoding and NMS without allocation
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#ifndef DETECT_H
+#define DETECT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* cells per side of the NMS grid at most */
+#define DETECT_GRID_MAX 16
+
+    /* row layout of a YOLO output: box, objectness, then one score per class */
+    enum DETECT_INDEX
+    {
+        DETECT_X_INDEX = 0,
+        DETECT_Y_INDEX = 1,
+        DETECT_W_INDEX = 2,
+        DETECT_H_INDEX = 3,
+        DETECT_C_INDEX = 4,
+        DETECT_T_INDEX = 5
+    };
+
+    typedef struct
+    {
+        uint16_t x;         /* centre, in model input pixels */
+        uint16_t y;
+        uint16_t w;
+        uint16_t h;
+        uint8_t confidence; /* % */
+        uint8_t target;     /* class */
+    } detect_box_t;
+
+    typedef enum
+    {
+        DETECT_DECODE_FLOAT = 0,     /* objectness of every row dequantized and compared in % */
+        DETECT_DECODE_QUANTIZED = 1, /* compared as int8 against threshold_q, see detect_prepare() */
+    } detect_decode_t;
+
+    typedef enum
+    {
+        DETECT_NMS_HARD = 0,     /* drop a box overlapping a kept one by iou or more */
+        DETECT_NMS_LINEAR = 1,   /* scale its confidence by 1 - overlap instead, from iou on */
+        DETECT_NMS_GAUSSIAN = 2, /* scale it by exp(-overlap^2 / sigma), whatever the overlap */
+    } detect_nms_t;
+
+    typedef struct
+    {
+        int num_record;          /* rows of the output */
+        int num_class;
+        float scale;             /* quantization of the output */
+        int zero_point;
+        uint16_t width, height;  /* model input, the boxes are clipped to it */
+        uint8_t threshold;       /* confidence %, rows below it are dropped */
+        uint8_t iou;             /* overlap % at which the less confident box of a class goes */
+        detect_nms_t nms;
+        uint8_t sigma;           /* of the gaussian decay, in % */
+        detect_decode_t decode;
+        int16_t threshold_q;     /* lowest objectness byte at or above the threshold, 128 for none */
+        bool binned;             /* hard NMS compares a box with the kept boxes of its grid neighbourhood only */
+        bool agnostic;           /* NMS across classes: a more confident box of any class suppresses */
+    } detect_config_t;
+
+    /*
+     * Scratch of detect_yolo(), in a buffer of the caller: a bounded
+     * candidate heap of top_n boxes per class and the NMS grid, so the
+     * memory used is fixed by the model and never depends on the scene.
+     */
+    typedef struct
+    {
+        detect_box_t *boxes; /* num_class * top_n */
+        uint16_t *counts;    /* candidates of each class */
+        int16_t *next;       /* per kept box, the next one in its grid cell */
+        uint16_t *scores;    /* confidence << 8 of the candidates, decayed by soft-NMS */
+        int16_t *cells;      /* DETECT_GRID_MAX^2 first kept box of each cell */
+        uint16_t num_class;
+        uint16_t top_n;
+    } detect_workspace_t;
+
+    /**
+     * @brief Switch the config to the quantized decode
+     *
+     * Works out once, from scale, zero_point and threshold, the int8
+     * objectness that passes the threshold, so the scan over the rows is an
+     * integer compare and only the rows that pass are dequantized. The rows
+     * kept are exactly those of the float decode.
+     */
+    void detect_prepare(detect_config_t *config);
+
+    /*
+     * IoU in integers: box edges are taken at twice the scale so the half
+     * sizes stay exact, and nothing wraps for boxes apart or past the edge.
+     */
+
+    /* true if a and b overlap by iou % or more: a cross-multiplied compare, no division */
+    bool detect_iou_at_least(const detect_box_t *a, const detect_box_t *b, uint8_t iou);
+
+    /* intersection over union of a and b in Q15, 0 if they do not overlap */
+    uint16_t detect_iou_q15(const detect_box_t *a, const detect_box_t *b);
+
+    /* exp(-x) in Q15 for x in Q15, interpolated in a table, 0 from x = 8 on */
+    uint16_t detect_exp_neg_q15(uint32_t x);
+
+    /* bytes of buffer detect_workspace_init() needs */
+    size_t detect_workspace_size(uint16_t num_class, uint16_t top_n);
+
+    /**
+     * @brief Lay the workspace out in a buffer
+     *
+     * @param buffer  detect_workspace_size() bytes, aligned for uint16_t, kept by the workspace
+     * @return 0 on success, -1 if the buffer is too small or num_class * top_n over INT16_MAX
+     */
+    int detect_workspace_init(detect_workspace_t *ws, void *buffer, size_t size, uint16_t num_class, uint16_t top_n);
+
+    /**
+     * @brief Decode a YOLO output and suppress the overlapping boxes
+     *
+     * Rows above the threshold go into the heap of their best class, which
+     * keeps the top_n most confident. Each class is then sorted by confidence
+     * and greedy NMS keeps a box unless a more confident kept box of its
+     * class (of any class if agnostic) overlaps it by iou or more. Ties are
+     * broken on the box itself, so the result does not depend on the order
+     * of the rows. Binned NMS gives the same boxes as comparing every pair.
+     *
+     * Soft-NMS lowers the confidence of the overlapping boxes rather than
+     * dropping them, takes the most confident box left after every decay
+     * and drops the boxes that fall under the threshold.
+     *
+     * @param output   num_record rows of num_class + DETECT_T_INDEX int8 values
+     * @param ws       workspace for at least config->num_class classes
+     * @param out      boxes found, the most confident if there are more than max_out,
+     *                 ordered by x, from the right
+     * @param found    set to the boxes found before the max_out cut, may be NULL
+     * @return boxes written to out, -1 if the workspace has too few classes
+     */
+    int detect_yolo(const int8_t *output, const detect_config_t *config, detect_workspace_t *ws,
+                    detect_box_t *out, int max_out, int *found);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
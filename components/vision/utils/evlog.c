@@ -0,0 +1,245 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      evlog.c
+* @brief     Binary event log, formatted off the hot path
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "evlog.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+#define EVLOG_LINE 160
+
+int evlog_init(evlog_t *log, size_t records)
+{
+    size_t n = 1;
+    while (n < records)
+    {
+        n <<= 1;
+    }
+    log->records = (evlog_record_t *)malloc(n * sizeof(evlog_record_t));
+    if (log->records == NULL)
+    {
+        return -1;
+    }
+    log->mask = n - 1;
+    log->head = 0;
+    log->tail = 0;
+    log->dropped = 0;
+    log->reported = 0;
+    log->task = NULL;
+    return 0;
+}
+
+void evlog_release(evlog_t *log)
+{
+    free(log->records);
+    log->records = NULL;
+}
+
+bool evlog_write(evlog_t *log, const char *fmt, uint8_t argc, const intptr_t *args)
+{
+    // head is ours, tail only moves forward, so the free space seen here can only grow
+    uint32_t head = log->head;
+    uint32_t tail = __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE);
+    if (log->records == NULL || head - tail > log->mask)
+    {
+        // only the producer counts, the consumer just reads it
+        __atomic_store_n(&log->dropped, log->dropped + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    evlog_record_t *record = &log->records[head & log->mask];
+    record->fmt = fmt;
+    record->argc = argc < EVLOG_MAX_ARGS ? argc : EVLOG_MAX_ARGS;
+    memcpy(record->args, args, record->argc * sizeof(intptr_t));
+    // publish the record only once it is complete
+    __atomic_store_n(&log->head, head + 1, __ATOMIC_RELEASE);
+
+#ifdef ESP_PLATFORM
+    // wake the formatter on every record: waking it only when the tail read above said empty misses the
+    // formatter emptying the ring and going to sleep in between. To a task of lower priority it only bumps a count
+    if (log->task)
+    {
+        xTaskNotifyGive((TaskHandle_t)log->task);
+    }
+#endif
+    return true;
+}
+
+int evlog_format(char *buf, size_t size, const evlog_record_t *record)
+{
+    const char *p = record->fmt;
+    size_t n = 0;
+    uint8_t arg = 0;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+    while (*p && n + 1 < size)
+    {
+        if (*p != '%' || p[1] == '%')
+        {
+            buf[n++] = *p;
+            p += *p == '%' ? 2 : 1;
+            continue;
+        }
+
+        // one conversion at a time, every argument is stored at intptr_t width so length modifiers go
+        char spec[16];
+        size_t len = 0;
+        spec[len++] = *p++;
+        while (*p && strchr("diouxXcsfFeEgGp", *p) == NULL)
+        {
+            if (strchr("hlLqjzt", *p) == NULL && len < sizeof(spec) - 2)
+            {
+                spec[len++] = *p;
+            }
+            p++;
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        char conv = *p++;
+        spec[len++] = conv;
+        spec[len] = '\0';
+
+        intptr_t value = arg < record->argc ? record->args[arg] : 0;
+        arg++;
+        int w;
+        switch (conv)
+        {
+        case 's':
+            w = snprintf(buf + n, size - n, spec, value ? (const char *)value : "(null)");
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        {
+            int32_t bits = (int32_t)value;
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+            w = snprintf(buf + n, size - n, spec, (double)f);
+            break;
+        }
+        case 'p':
+            w = snprintf(buf + n, size - n, spec, (void *)value);
+            break;
+        default:
+            w = snprintf(buf + n, size - n, spec, (int)value);
+            break;
+        }
+        if (w < 0)
+        {
+            break;
+        }
+        n += (size_t)w < size - n ? (size_t)w : size - n - 1;
+    }
+    buf[n] = '\0';
+    return (int)n;
+}
+
+static int evlog_stdout(const char *line, void *ctx)
+{
+    return fputs(line, stdout);
+}
+
+size_t evlog_drain(evlog_t *log, size_t max, evlog_emit_t emit, void *ctx)
+{
+    char line[EVLOG_LINE];
+    size_t count = 0;
+
+    emit = emit ? emit : evlog_stdout;
+
+    uint32_t dropped = __atomic_load_n(&log->dropped, __ATOMIC_RELAXED);
+    if (dropped != log->reported)
+    {
+        snprintf(line, sizeof(line), "evlog: %u records dropped\n", (unsigned)(dropped - log->reported));
+        emit(line, ctx);
+        log->reported = dropped;
+    }
+
+    uint32_t tail = log->tail;
+    uint32_t head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+    while (tail != head && count < max)
+    {
+        evlog_format(line, sizeof(line), &log->records[tail & log->mask]);
+        // the slot is free for the producer once tail has passed it
+        __atomic_store_n(&log->tail, ++tail, __ATOMIC_RELEASE);
+        emit(line, ctx);
+        count++;
+    }
+    return count;
+}
+
+#ifdef ESP_PLATFORM
+typedef struct
+{
+    evlog_t *log;
+    evlog_emit_t emit;
+    void *ctx;
+} evlog_task_t;
+
+static void evlog_task(void *arg)
+{
+    evlog_task_t *task = (evlog_task_t *)arg;
+
+    while (true)
+    {
+        // a record wakes the task up, drops are reported at least every second
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+        while (evlog_drain(task->log, 16, task->emit, task->ctx))
+        {
+        }
+    }
+}
+
+int evlog_start(evlog_t *log, uint8_t priority, int core, evlog_emit_t emit, void *ctx)
+{
+    evlog_task_t *task = (evlog_task_t *)malloc(sizeof(evlog_task_t));
+    if (task == NULL)
+    {
+        return -1;
+    }
+    task->log = log;
+    task->emit = emit;
+    task->ctx = ctx;
+
+    TaskHandle_t handle = NULL;
+    if (xTaskCreatePinnedToCore(evlog_task, "evlog", 3 * 1024, task, priority, &handle,
+                                core < 0 ? tskNO_AFFINITY : core) != pdPASS)
+    {
+        free(task);
+        return -1;
+    }
+    log->task = handle;
+    return 0;
+}
+
+uint32_t evlog_flush(evlog_t *log, uint32_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    while (evlog_pending(log) && (xTaskGetTickCount() - start) < pdMS_TO_TICKS(timeout_ms))
+    {
+        vTaskDelay(1);
+    }
+    return evlog_pending(log);
+}
+#endif
@@ -0,0 +1,143 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      evlog.h
+* @brief     Binary event log, formatted off the hot path
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#ifndef EVLOG_H
+#define EVLOG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* arguments of a record, enough for a whole line of a tracked YOLO object */
+#define EVLOG_MAX_ARGS 7
+
+    /*
+     * One log line, not yet formatted: the format string is kept by pointer,
+     * so it has to be a literal (or live as long as the log), and so do the
+     * strings passed with EVLOG_S().
+     */
+    typedef struct
+    {
+        const char *fmt;
+        uint8_t argc;
+        intptr_t args[EVLOG_MAX_ARGS];
+    } evlog_record_t;
+
+    /* where the formatted lines go, returns < 0 on error like fputs() */
+    typedef int (*evlog_emit_t)(const char *line, void *ctx);
+
+    /**
+     * @brief Lock-free single-producer, single-consumer ring of records
+     *
+     * One task writes with evlog_write() and never blocks: a full ring drops
+     * the record and counts it. One task reads with evlog_drain(), usually the
+     * low-priority formatter started by evlog_start(), and reports the drops.
+     * Keep one per producing task, zero-initialised.
+     */
+    typedef struct
+    {
+        evlog_record_t *records;
+        uint32_t mask;             /* records - 1, a power of two */
+        volatile uint32_t head;    /* next record to write, only the producer stores it */
+        volatile uint32_t tail;    /* next record to read, only the consumer stores it */
+        volatile uint32_t dropped; /* records the ring had no room for */
+        uint32_t reported;         /* drops the consumer has reported */
+        void *task;                /* formatter task, woken by every record */
+    } evlog_t;
+
+    /**
+     * @brief Allocate the ring
+     *
+     * @param log      zero-initialised log
+     * @param records  capacity, rounded up to a power of two
+     * @return 0 on success, -1 if out of memory
+     */
+    int evlog_init(evlog_t *log, size_t records);
+
+    /* free the ring, the formatter task must be gone */
+    void evlog_release(evlog_t *log);
+
+    /**
+     * @brief Append a record, from the producer task
+     *
+     * @param fmt   printf format, %s takes EVLOG_S() and %f/%e/%g take EVLOG_F() arguments
+     * @param argc  arguments, up to EVLOG_MAX_ARGS
+     * @param args  EVLOG_I(), EVLOG_S() or EVLOG_F() values
+     * @return false if the ring was full and the record was dropped
+     */
+    bool evlog_write(evlog_t *log, const char *fmt, uint8_t argc, const intptr_t *args);
+
+    /**
+     * @brief Format and emit queued records, from the consumer task
+     *
+     * Drops since the last call are reported as a line of their own first.
+     *
+     * @param max   records to take at most
+     * @param emit  line sink, NULL for stdout
+     * @return records emitted
+     */
+    size_t evlog_drain(evlog_t *log, size_t max, evlog_emit_t emit, void *ctx);
+
+    /* printf one record into buf, returns the length written */
+    int evlog_format(char *buf, size_t size, const evlog_record_t *record);
+
+    /* records written and not read yet */
+    static inline uint32_t evlog_pending(const evlog_t *log)
+    {
+        return log->head - log->tail;
+    }
+
+#ifdef ESP_PLATFORM
+    /**
+     * @brief Start a task that drains the log as records come in
+     *
+     * @param priority  below the producer's, the formatter only gets the idle time
+     * @param core      core to pin it to, -1 for any
+     * @param emit      line sink, NULL for stdout
+     * @return 0 on success, -1 if the task could not be created
+     */
+    int evlog_start(evlog_t *log, uint8_t priority, int core, evlog_emit_t emit, void *ctx);
+
+    /* wait up to timeout_ms for the formatter to empty the ring, returns records still pending */
+    uint32_t evlog_flush(evlog_t *log, uint32_t timeout_ms);
+#endif
+
+    static inline intptr_t evlog_float(float f)
+    {
+        int32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+#define EVLOG_I(x) ((intptr_t)(x))
+#define EVLOG_S(s) ((intptr_t)(const char *)(s))
+#define EVLOG_F(f) evlog_float((float)(f))
+
+/* EVLOG(log, "x: %d, %s\n", EVLOG_I(x), EVLOG_S(name)) */
+#define EVLOG(log, fmt, ...)                                                                          \
+    do                                                                                                \
+    {                                                                                                 \
+        const intptr_t evlog_args_[] = {0, ##__VA_ARGS__};                                            \
+        evlog_write((log), (fmt), sizeof(evlog_args_) / sizeof(evlog_args_[0]) - 1, evlog_args_ + 1); \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
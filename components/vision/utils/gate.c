@@ -0,0 +1,83 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      gate.c
+* @brief     Scene change gate, to skip inference on static frames
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "gate.h"
+
+int frame_gate_init(frame_gate_t *gate, uint16_t w, uint16_t h, uint8_t threshold, uint8_t area, uint16_t max_skip)
+{
+    uint32_t size = (uint32_t)w * h;
+
+    memset(gate, 0, sizeof(frame_gate_t));
+    gate->thumbnail = (uint8_t *)malloc(size);
+    gate->reference = (uint8_t *)malloc(size);
+    if (gate->thumbnail == NULL || gate->reference == NULL)
+    {
+        frame_gate_release(gate);
+        return -1;
+    }
+    gate->w = w;
+    gate->h = h;
+    gate->threshold = threshold;
+    gate->cells = (uint16_t)(size * (area > 100 ? 100 : area) / 100);
+    gate->cells = gate->cells ? gate->cells : 1;
+    gate->max_skip = max_skip;
+    // no reference yet, the first frame goes through
+    gate->run = UINT16_MAX;
+    return 0;
+}
+
+void frame_gate_release(frame_gate_t *gate)
+{
+    free(gate->thumbnail);
+    free(gate->reference);
+    gate->thumbnail = NULL;
+    gate->reference = NULL;
+}
+
+bool frame_gate_check(frame_gate_t *gate)
+{
+    const uint8_t *a = gate->thumbnail;
+    const uint8_t *b = gate->reference;
+    uint32_t size = (uint32_t)gate->w * gate->h;
+    uint32_t changed = 0;
+
+    gate->frames++;
+    if (gate->run < gate->max_skip)
+    {
+        // stop counting once the frame has changed enough, the rest makes no difference
+        for (uint32_t i = 0; i < size && changed < gate->cells; i++)
+        {
+            int d = a[i] - b[i];
+            changed += (d > gate->threshold) | (d < -gate->threshold);
+        }
+        gate->changed = (uint16_t)changed;
+        if (changed < gate->cells)
+        {
+            gate->run++;
+            gate->skipped++;
+            return false;
+        }
+    }
+
+    // the frame goes through and is the new reference
+    gate->thumbnail = gate->reference;
+    gate->reference = (uint8_t *)a;
+    gate->run = 0;
+    return true;
+}
+
+void frame_gate_reset(frame_gate_t *gate)
+{
+    gate->run = UINT16_MAX;
+}
@@ -0,0 +1,80 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      gate.h
+* @brief     Scene change gate, to skip inference on static frames
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#ifndef GATE_H
+#define GATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Compares a luminance thumbnail of each frame with the last one let through
+     *
+     * The caller converts every frame into the thumbnail (gray, w * h bytes,
+     * see frame_gate_thumbnail()), frame_gate_check() then tells whether the
+     * frame differs enough from the reference to be worth running the model
+     * on. Comparing with the last frame let through rather than the previous
+     * one, a slow drift adds up until it counts as a change.
+     */
+    typedef struct
+    {
+        uint16_t w, h;        /* thumbnail size */
+        uint8_t threshold;    /* luminance step of a thumbnail pixel that counts as a change */
+        uint16_t cells;       /* changed pixels that make the frame count as changed, at least 1 */
+        uint16_t max_skip;    /* frames skipped in a row at most, 0 never skips */
+        uint8_t *thumbnail;   /* the current frame */
+        uint8_t *reference;   /* the last frame let through, NULL before the first one */
+        uint16_t run;         /* frames skipped since the last one let through */
+        uint32_t frames;      /* checked */
+        uint32_t skipped;     /* checked and found unchanged */
+        uint16_t changed;     /* changed pixels of the last check */
+    } frame_gate_t;
+
+    /**
+     * @brief Allocate the thumbnails
+     *
+     * @param w, h       thumbnail size, 32 x 24 is plenty to see something move
+     * @param threshold  luminance step per pixel above the sensor noise
+     * @param area       % of the thumbnail that has to change, 0 for any pixel
+     * @param max_skip   frames skipped in a row at most, so a slow scene is still looked at now and then
+     * @return 0 on success, -1 if out of memory
+     */
+    int frame_gate_init(frame_gate_t *gate, uint16_t w, uint16_t h, uint8_t threshold, uint8_t area, uint16_t max_skip);
+
+    void frame_gate_release(frame_gate_t *gate);
+
+    /* where to convert the frame to, w * h gray bytes */
+    static inline uint8_t *frame_gate_thumbnail(frame_gate_t *gate)
+    {
+        return gate->thumbnail;
+    }
+
+    /**
+     * @brief Decide on the frame in the thumbnail
+     *
+     * @return true to run the model on it, it becomes the reference; false to skip it
+     */
+    bool frame_gate_check(frame_gate_t *gate);
+
+    /* let the next frame through whatever it looks like */
+    void frame_gate_reset(frame_gate_t *gate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
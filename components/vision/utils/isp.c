@@ -0,0 +1,1300 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      isp.h
+* @brief
+* @author    Hongtai Liu (lht856@foxmail.com)
+* @date      2022-05-19
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "isp.h"
+
+#if defined(ESP_PLATFORM) && defined(CONFIG_ISP_PARALLEL)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#define ISP_PARALLEL 1
+#else
+#define ISP_PARALLEL 0
+#endif
+
+
+#define CLIP(value) (unsigned char)(((value) > 0xFF) ? 0xff : (((value) < 0) ? 0 : (value)))
+
+const uint8_t _RGB565_TO_RGB_888_TABLE_5[] = {
+    0, 8, 16, 25, 33, 41, 49, 58, 66, 74, 82, 90, 99, 107, 115, 123, 132, 140, 148, 156, 165, 173, 181, 189, 197, 206, 214, 222, 230, 239, 247, 255};
+
+const uint8_t _RGB565_TO_RGB_888_TABLE_6[] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 45, 49, 53, 57, 61, 65, 69, 73, 77, 81, 85, 89, 93, 97, 101, 105, 109, 113, 117, 121, 125, 130, 134, 138, 142, 146, 150, 154, 158, 162, 166, 170, 174, 178, 182, 186, 190, 194, 198, 202, 206, 210, 215, 219, 223, 227, 231, 235, 239, 243, 247, 251, 255};
+
+/*
+ * Contiguous RGB565 unpack, by table or word-parallel. The words hold two
+ * big-endian pixels, one per 16-bit lane, so each field is extracted and
+ * expanded for both pixels at once, eight pixels per iteration. The expansion
+ * round(v * 255 / 31) = (v * 527 + 23) >> 6 (and (v * 259 + 33) >> 6 for 6 bits)
+ * stays within a lane and matches the tables above bit for bit. Whether that
+ * beats the table lookups depends on the core, so the tables stay the default
+ * and CONFIG_ISP_RGB565_SWAR picks the word-parallel kernels where they measure
+ * faster. Big-endian builds always use the tables.
+ */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ISP_SWAR 1
+#else
+#define ISP_SWAR 0
+#endif
+
+#define RGB565_R2(v) ((v) >> 3 & 0x001F001F)
+#define RGB565_G2(v) (((v) & 0x00070007) << 3 | ((v) >> 13 & 0x00070007))
+#define RGB565_B2(v) ((v) >> 8 & 0x001F001F)
+#define EXPAND5_2(v) (((v) * 527 + 0x00170017) >> 6 & 0x00FF00FF)
+#define EXPAND6_2(v) (((v) * 259 + 0x00210021) >> 6 & 0x00FF00FF)
+
+/* the gray weights of the original converter, r taken from the low bits; x / 1000 == ((x >> 3) * 33555) >> 22 here */
+#define RGB565_GRAY(hi, g, lo) ((((lo) * 299 + (g) * 587 + (hi) * 114) >> 3) * 33555 >> 22)
+
+static inline uint32_t load32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+void rgb565_unpack_rgb888_table(uint8_t *pdst, const uint8_t *psrc, int n)
+{
+    for (int j = 0; j < n; j++, psrc += 2, pdst += 3)
+    {
+        pdst[0] = _RGB565_TO_RGB_888_TABLE_5[psrc[0] >> 3];
+        pdst[1] = _RGB565_TO_RGB_888_TABLE_6[((psrc[0] & 0x07) << 3) | (psrc[1] >> 5)];
+        pdst[2] = _RGB565_TO_RGB_888_TABLE_5[psrc[1] & 0x1F];
+    }
+}
+
+void rgb565_unpack_gray_table(uint8_t *pdst, const uint8_t *psrc, int n)
+{
+    for (int j = 0; j < n; j++, psrc += 2)
+    {
+        uint8_t hi = _RGB565_TO_RGB_888_TABLE_5[psrc[0] >> 3];
+        uint8_t g = _RGB565_TO_RGB_888_TABLE_6[((psrc[0] & 0x07) << 3) | (psrc[1] >> 5)];
+        uint8_t lo = _RGB565_TO_RGB_888_TABLE_5[psrc[1] & 0x1F];
+        *pdst++ = RGB565_GRAY(hi, g, lo);
+    }
+}
+
+void rgb565_unpack_rgb888_swar(uint8_t *pdst, const uint8_t *psrc, int n)
+{
+    int j = 0;
+
+#if ISP_SWAR
+    for (; j + 8 <= n; j += 8, psrc += 16, pdst += 24)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            uint32_t v = load32(psrc + k * 4);
+            uint32_t r = EXPAND5_2(RGB565_R2(v));
+            uint32_t g = EXPAND6_2(RGB565_G2(v));
+            uint32_t b = EXPAND5_2(RGB565_B2(v));
+            uint8_t *p = pdst + k * 6;
+            p[0] = r;
+            p[1] = g;
+            p[2] = b;
+            p[3] = r >> 16;
+            p[4] = g >> 16;
+            p[5] = b >> 16;
+        }
+    }
+#endif
+    rgb565_unpack_rgb888_table(pdst, psrc, n - j);
+}
+
+void rgb565_unpack_gray_swar(uint8_t *pdst, const uint8_t *psrc, int n)
+{
+    int j = 0;
+
+#if ISP_SWAR
+    for (; j + 8 <= n; j += 8, psrc += 16, pdst += 8)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            uint32_t v = load32(psrc + k * 4);
+            uint32_t hi = EXPAND5_2(RGB565_R2(v));
+            uint32_t g = EXPAND6_2(RGB565_G2(v));
+            uint32_t lo = EXPAND5_2(RGB565_B2(v));
+            pdst[k * 2] = RGB565_GRAY(hi & 0xFF, g & 0xFF, lo & 0xFF);
+            pdst[k * 2 + 1] = RGB565_GRAY(hi >> 16, g >> 16, lo >> 16);
+        }
+    }
+#endif
+    rgb565_unpack_gray_table(pdst, psrc, n - j);
+}
+
+void rgb565_unpack_rgb888(uint8_t *pdst, const uint8_t *psrc, int n)
+{
+#if defined(CONFIG_ISP_RGB565_SWAR)
+    rgb565_unpack_rgb888_swar(pdst, psrc, n);
+#else
+    rgb565_unpack_rgb888_table(pdst, psrc, n);
+#endif
+}
+
+void rgb565_unpack_gray(uint8_t *pdst, const uint8_t *psrc, int n)
+{
+#if defined(CONFIG_ISP_RGB565_SWAR)
+    rgb565_unpack_gray_swar(pdst, psrc, n);
+#else
+    rgb565_unpack_gray_table(pdst, psrc, n);
+#endif
+}
+
+/* keep_pad buffers remembered, enough for the per-slot inputs of a model */
+#define ISP_PAD_BUFFERS 4
+
+typedef struct
+{
+    uint8_t *line;     /* one target row, staged here when it has to be scattered */
+    uint8_t *dec[2];   /* decoded source pixels */
+    uint16_t *hrow[2]; /* horizontally filtered source rows */
+    int htag[2];       /* source row held by hrow[], -1 if none */
+    int ready;         /* source rows known to be in memory */
+    uint32_t *acc;     /* area: column sums of the source rows of one target row */
+} isp_work_t;
+
+struct isp_plan
+{
+    int h, w;       /* geometry the tables were built for */
+    int th, tw;
+    uint8_t filter;
+    uint8_t letterbox;
+    isp_rect_t roi; /* region as requested, and clipped to the frame */
+    int x0, y0;
+    int rw, rh;
+    int ox, oy;     /* the resampled frame covers cw x ch target pixels from (ox, oy) */
+    int cw, ch;
+    isp_transform_t transform;
+    uint8_t rotation;
+    struct
+    {
+        void *dst;  /* buffer the padding was written to, and with which byte */
+        int byte;
+    } pad[ISP_PAD_BUFFERS];
+    uint8_t pad_next; /* entry of pad[] to reuse for a new buffer */
+    uint32_t *row;  /* nearest: source row, bilinear: upper row, area: first row */
+    uint16_t *wy;   /* bilinear: weight of the lower row in 1/256, area: row count */
+    uint32_t *ry;   /* area: 65536 / row count */
+    uint16_t *col;  /* nearest: source column, bilinear: left column, area: first column */
+    uint16_t *col1; /* bilinear: right column, area: 0, 1, ... w - 1 */
+    uint16_t *wx;   /* bilinear: weight of the right column in 1/256, area: column count */
+    uint32_t *rx;   /* area: 32768 / column count */
+    int wide;
+    uint8_t contiguous; /* col[] is x0, x0 + 1, ... so rows can be unpacked as a run */
+    isp_work_t work[2]; /* scratch of each core, work[1] only in parallel mode */
+};
+
+/* gather n pixels of source row y at the columns in col[] into out */
+typedef void (*isp_decode_t)(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable);
+
+static void decode_rgb565_rgb888(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w * 2;
+
+    if (qtable)
+    {
+        int8_t *pdst = (int8_t *)out;
+        for (int j = 0; j < n; j++)
+        {
+            const uint8_t *p = prow + col[j] * 2;
+            pdst[0] = qtable[_RGB565_TO_RGB_888_TABLE_5[p[0] >> 3]];
+            pdst[1] = qtable[_RGB565_TO_RGB_888_TABLE_6[((p[0] & 0x07) << 3) | (p[1] >> 5)]];
+            pdst[2] = qtable[_RGB565_TO_RGB_888_TABLE_5[p[1] & 0x1F]];
+            pdst += 3;
+        }
+    }
+    else
+    {
+        uint8_t *pdst = (uint8_t *)out;
+        for (int j = 0; j < n; j++)
+        {
+            const uint8_t *p = prow + col[j] * 2;
+            pdst[0] = _RGB565_TO_RGB_888_TABLE_5[p[0] >> 3];
+            pdst[1] = _RGB565_TO_RGB_888_TABLE_6[((p[0] & 0x07) << 3) | (p[1] >> 5)];
+            pdst[2] = _RGB565_TO_RGB_888_TABLE_5[p[1] & 0x1F];
+            pdst += 3;
+        }
+    }
+}
+
+static inline uint8_t rgb565_gray(const uint8_t *p)
+{
+    // keeps the channel order of the original converter: r is taken from the low bits
+    uint8_t b = _RGB565_TO_RGB_888_TABLE_5[p[0] >> 3];
+    uint8_t g = _RGB565_TO_RGB_888_TABLE_6[((p[0] & 0x07) << 3) | (p[1] >> 5)];
+    uint8_t r = _RGB565_TO_RGB_888_TABLE_5[p[1] & 0x1F];
+    return (r * 299 + g * 587 + b * 114) / 1000;
+}
+
+static void decode_rgb565_gray(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w * 2;
+
+    if (qtable)
+    {
+        int8_t *pdst = (int8_t *)out;
+        for (int j = 0; j < n; j++)
+        {
+            pdst[j] = qtable[rgb565_gray(prow + col[j] * 2)];
+        }
+    }
+    else
+    {
+        uint8_t *pdst = (uint8_t *)out;
+        for (int j = 0; j < n; j++)
+        {
+            pdst[j] = rgb565_gray(prow + col[j] * 2);
+        }
+    }
+}
+
+static inline void yuv_rgb(int32_t y, int32_t cb, int32_t cr, uint8_t *rgb)
+{
+    int32_t r = (int32_t)(y + (14065 * (cr - 128)) / 10000);
+    int32_t g = (int32_t)(y - (3455 * (cb - 128)) / 10000 - (7169 * (cr - 128)) / 10000);
+    int32_t b = (int32_t)(y + (17790 * (cb - 128)) / 10000);
+
+    rgb[0] = CLIP(r);
+    rgb[1] = CLIP(g);
+    rgb[2] = CLIP(b);
+}
+
+static inline void yuv422p_rgb(const uint8_t *psrc, int h, int w, uint32_t index, uint8_t *rgb)
+{
+    uint32_t u_chunk = w * h;
+    uint32_t v_chunk = w * h + w * h / 2;
+
+    yuv_rgb(psrc[index], psrc[u_chunk + (index >> 1)], psrc[v_chunk + (index >> 1)], rgb);
+}
+
+static void decode_yuv422p_rgb888(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    uint32_t base = (uint32_t)y * w;
+    uint8_t rgb[3];
+
+    if (qtable)
+    {
+        int8_t *pdst = (int8_t *)out;
+        for (int j = 0; j < n; j++)
+        {
+            yuv422p_rgb(psrc, h, w, base + col[j], rgb);
+            pdst[0] = qtable[rgb[0]];
+            pdst[1] = qtable[rgb[1]];
+            pdst[2] = qtable[rgb[2]];
+            pdst += 3;
+        }
+    }
+    else
+    {
+        uint8_t *pdst = (uint8_t *)out;
+        for (int j = 0; j < n; j++)
+        {
+            yuv422p_rgb(psrc, h, w, base + col[j], pdst);
+            pdst += 3;
+        }
+    }
+}
+
+static void decode_yuv422p_gray(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    uint32_t base = (uint32_t)y * w;
+    uint8_t rgb[3];
+
+    for (int j = 0; j < n; j++)
+    {
+        yuv422p_rgb(psrc, h, w, base + col[j], rgb);
+        uint8_t gray = (rgb[0] * 299 + rgb[1] * 587 + rgb[2] * 114) / 1000;
+        if (qtable)
+            ((int8_t *)out)[j] = qtable[gray];
+        else
+            ((uint8_t *)out)[j] = gray;
+    }
+}
+
+/* packed YUV422: Y0 U Y1 V, the chroma is shared by each pixel pair */
+static void decode_yuv422_rgb888(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w * 2;
+    uint8_t rgb[3];
+
+    for (int j = 0; j < n; j++)
+    {
+        const uint8_t *p = prow + (col[j] & ~1) * 2;
+        yuv_rgb(prow[col[j] * 2], p[1], p[3], rgb);
+        if (qtable)
+        {
+            ((int8_t *)out)[j * 3 + 0] = qtable[rgb[0]];
+            ((int8_t *)out)[j * 3 + 1] = qtable[rgb[1]];
+            ((int8_t *)out)[j * 3 + 2] = qtable[rgb[2]];
+        }
+        else
+        {
+            ((uint8_t *)out)[j * 3 + 0] = rgb[0];
+            ((uint8_t *)out)[j * 3 + 1] = rgb[1];
+            ((uint8_t *)out)[j * 3 + 2] = rgb[2];
+        }
+    }
+}
+
+/* the luma is the gray image already, every other byte */
+static void decode_yuv422_gray(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w * 2;
+
+    if (qtable)
+    {
+        int8_t *pdst = (int8_t *)out;
+        for (int j = 0; j < n; j++)
+            pdst[j] = qtable[prow[col[j] * 2]];
+    }
+    else
+    {
+        uint8_t *pdst = (uint8_t *)out;
+        for (int j = 0; j < n; j++)
+            pdst[j] = prow[col[j] * 2];
+    }
+}
+
+/* already decoded frames (e.g. a JPEG), only resampled and converted */
+static void decode_rgb888_rgb888(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w * 3;
+
+    for (int j = 0; j < n; j++)
+    {
+        const uint8_t *p = prow + col[j] * 3;
+        if (qtable)
+        {
+            ((int8_t *)out)[j * 3 + 0] = qtable[p[0]];
+            ((int8_t *)out)[j * 3 + 1] = qtable[p[1]];
+            ((int8_t *)out)[j * 3 + 2] = qtable[p[2]];
+        }
+        else
+        {
+            ((uint8_t *)out)[j * 3 + 0] = p[0];
+            ((uint8_t *)out)[j * 3 + 1] = p[1];
+            ((uint8_t *)out)[j * 3 + 2] = p[2];
+        }
+    }
+}
+
+static void decode_rgb888_gray(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w * 3;
+
+    for (int j = 0; j < n; j++)
+    {
+        const uint8_t *p = prow + col[j] * 3;
+        uint8_t gray = (p[0] * 299 + p[1] * 587 + p[2] * 114) / 1000;
+        if (qtable)
+            ((int8_t *)out)[j] = qtable[gray];
+        else
+            ((uint8_t *)out)[j] = gray;
+    }
+}
+
+static void decode_gray_rgb888(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w;
+
+    for (int j = 0; j < n; j++)
+    {
+        uint8_t v = qtable ? (uint8_t)qtable[prow[col[j]]] : prow[col[j]];
+        ((uint8_t *)out)[j * 3 + 0] = v;
+        ((uint8_t *)out)[j * 3 + 1] = v;
+        ((uint8_t *)out)[j * 3 + 2] = v;
+    }
+}
+
+static void decode_gray_gray(void *out, const uint8_t *psrc, int h, int w, int y, const uint16_t *col, int n, const int8_t *qtable)
+{
+    const uint8_t *prow = psrc + (uint32_t)y * w;
+
+    if (qtable)
+    {
+        int8_t *pdst = (int8_t *)out;
+        for (int j = 0; j < n; j++)
+            pdst[j] = qtable[prow[col[j]]];
+    }
+    else
+    {
+        uint8_t *pdst = (uint8_t *)out;
+        for (int j = 0; j < n; j++)
+            pdst[j] = prow[col[j]];
+    }
+}
+
+/* n pixels of row y from column x on, with the unpack kernels; -1 if the format has none */
+static int decode_span(const isp_config_t *config, uint8_t *out, const uint8_t *psrc, int y, int x, int n)
+{
+    const uint8_t *p = psrc + ((uint32_t)y * config->w + x) * 2;
+
+    if ((config->format == ISP_FORMAT_RGB888 && config->channels == 3) ||
+        (config->format == ISP_FORMAT_GRAY && config->channels == 1))
+    {
+        p = psrc + ((uint32_t)y * config->w + x) * config->channels;
+        memcpy(out, p, n * config->channels);
+        return 0;
+    }
+    if (config->format == ISP_FORMAT_YUV422 && config->channels == 1)
+    {
+        // a strided copy of the luma
+        for (int j = 0; j < n; j++)
+            out[j] = p[j * 2];
+        return 0;
+    }
+    if (config->format != ISP_FORMAT_RGB565)
+    {
+        return -1;
+    }
+
+    if (config->channels == 1)
+        rgb565_unpack_gray(out, p, n);
+    else
+        rgb565_unpack_rgb888(out, p, n);
+    return 0;
+}
+
+static isp_decode_t isp_decoder(const isp_config_t *config)
+{
+    switch (config->format)
+    {
+    case ISP_FORMAT_RGB565:
+        return config->channels == 1 ? decode_rgb565_gray : decode_rgb565_rgb888;
+    case ISP_FORMAT_YUV422P:
+        return config->channels == 1 ? decode_yuv422p_gray : decode_yuv422p_rgb888;
+    case ISP_FORMAT_YUV422:
+        return config->channels == 1 ? decode_yuv422_gray : decode_yuv422_rgb888;
+    case ISP_FORMAT_RGB888:
+        return config->channels == 1 ? decode_rgb888_gray : decode_rgb888_rgb888;
+    case ISP_FORMAT_GRAY:
+        return config->channels == 1 ? decode_gray_gray : decode_gray_rgb888;
+    default:
+        return NULL;
+    }
+}
+
+/* scatter n pixels staged in line, target row i from column j0 on, into their rotated place */
+static void store_left(uint8_t *pdst, const uint8_t *line, int i, int j0, int n, int th, int tw, int c)
+{
+    if (c == 1)
+    {
+        for (int j = 0; j < n; j++)
+            pdst[(tw - 1 - j0 - j) * th + i] = line[j];
+    }
+    else
+    {
+        for (int j = 0; j < n; j++)
+        {
+            uint8_t *p = pdst + ((tw - 1 - j0 - j) * th + i) * 3;
+            p[0] = line[j * 3 + 0];
+            p[1] = line[j * 3 + 1];
+            p[2] = line[j * 3 + 2];
+        }
+    }
+}
+
+static void store_right(uint8_t *pdst, const uint8_t *line, int i, int j0, int n, int th, int tw, int c)
+{
+    if (c == 1)
+    {
+        for (int j = 0; j < n; j++)
+            pdst[(j0 + j) * th + (th - 1 - i)] = line[j];
+    }
+    else
+    {
+        for (int j = 0; j < n; j++)
+        {
+            uint8_t *p = pdst + ((j0 + j) * th + (th - 1 - i)) * 3;
+            p[0] = line[j * 3 + 0];
+            p[1] = line[j * 3 + 1];
+            p[2] = line[j * 3 + 2];
+        }
+    }
+}
+
+static void store_down(uint8_t *pdst, const uint8_t *line, int i, int j0, int n, int th, int tw, int c)
+{
+    uint8_t *prow = pdst + (th - 1 - i) * tw * c;
+
+    if (c == 1)
+    {
+        for (int j = 0; j < n; j++)
+            prow[tw - 1 - j0 - j] = line[j];
+    }
+    else
+    {
+        for (int j = 0; j < n; j++)
+        {
+            uint8_t *p = prow + (tw - 1 - j0 - j) * 3;
+            p[0] = line[j * 3 + 0];
+            p[1] = line[j * 3 + 1];
+            p[2] = line[j * 3 + 2];
+        }
+    }
+}
+
+/* produce target row i into out, uint8 or int8 depending on config->qtable */
+typedef void (*isp_row_t)(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, const uint8_t *psrc, int i, uint8_t *out);
+
+static void row_nearest(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, const uint8_t *psrc, int i, uint8_t *out)
+{
+    if (plan->contiguous && decode_span(config, out, psrc, plan->row[i], plan->x0, plan->cw) == 0)
+    {
+        if (config->qtable)
+        {
+            int n = plan->cw * config->channels;
+            for (int k = 0; k < n; k++)
+                out[k] = (uint8_t)config->qtable[out[k]];
+        }
+        return;
+    }
+    isp_decoder(config)(out, psrc, config->h, config->w, plan->row[i], plan->col, plan->cw, config->qtable);
+}
+
+/* horizontally interpolate source row y into one of the two row slots, never evicting slot keep */
+static int bilinear_hrow(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, const uint8_t *psrc, int y, int keep)
+{
+    isp_decode_t decode = isp_decoder(config);
+    int tw = plan->cw;
+    int s;
+
+    if (work->htag[0] == y)
+        return 0;
+    if (work->htag[1] == y)
+        return 1;
+
+    // rows come in increasing order, so the older row is the one to drop
+    if (keep >= 0)
+        s = 1 - keep;
+    else
+        s = work->htag[0] < work->htag[1] ? 0 : 1;
+
+    decode(work->dec[0], psrc, config->h, config->w, y, plan->col, tw, NULL);
+    decode(work->dec[1], psrc, config->h, config->w, y, plan->col1, tw, NULL);
+
+    const uint8_t *p0 = work->dec[0];
+    const uint8_t *p1 = work->dec[1];
+    uint16_t *hrow = work->hrow[s];
+
+    if (config->channels == 1)
+    {
+        for (int j = 0; j < tw; j++)
+        {
+            uint32_t f = plan->wx[j];
+            hrow[j] = p0[j] * (256 - f) + p1[j] * f;
+        }
+    }
+    else
+    {
+        for (int j = 0; j < tw; j++)
+        {
+            uint32_t f = plan->wx[j];
+            hrow[j * 3 + 0] = p0[j * 3 + 0] * (256 - f) + p1[j * 3 + 0] * f;
+            hrow[j * 3 + 1] = p0[j * 3 + 1] * (256 - f) + p1[j * 3 + 1] * f;
+            hrow[j * 3 + 2] = p0[j * 3 + 2] * (256 - f) + p1[j * 3 + 2] * f;
+        }
+    }
+
+    work->htag[s] = y;
+    return s;
+}
+
+static void row_bilinear(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, const uint8_t *psrc, int i, uint8_t *out)
+{
+    int y0 = plan->row[i];
+    int y1 = y0 + 1 < plan->y0 + plan->rh ? y0 + 1 : y0;
+    uint32_t f = plan->wy[i];
+    int n = plan->cw * config->channels;
+
+    int s0 = bilinear_hrow(config, plan, work, psrc, y0, -1);
+    int s1 = bilinear_hrow(config, plan, work, psrc, y1, s0);
+    const uint16_t *h0 = work->hrow[s0];
+    const uint16_t *h1 = work->hrow[s1];
+
+    // both passes are in 1/256, so the sum is in 1/65536
+    if (config->qtable)
+    {
+        const int8_t *qtable = config->qtable;
+        for (int k = 0; k < n; k++)
+            out[k] = (uint8_t)qtable[(h0[k] * (256 - f) + h1[k] * f + 32768) >> 16];
+    }
+    else
+    {
+        for (int k = 0; k < n; k++)
+            out[k] = (h0[k] * (256 - f) + h1[k] * f + 32768) >> 16;
+    }
+}
+
+static void row_area(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, const uint8_t *psrc, int i, uint8_t *out)
+{
+    isp_decode_t decode = isp_decoder(config);
+    int tw = plan->cw;
+    int n = plan->rw * config->channels;
+    uint32_t *acc = work->acc;
+    const uint8_t *p = work->dec[0];
+
+    // column sums of the box rows, one pass over each source row
+    for (uint32_t y = plan->row[i]; y < plan->row[i] + plan->wy[i]; y++)
+    {
+        if (decode_span(config, work->dec[0], psrc, y, plan->x0, plan->rw) != 0)
+            decode(work->dec[0], psrc, config->h, config->w, y, plan->col1, plan->rw, NULL);
+        if (y == plan->row[i])
+        {
+            for (int k = 0; k < n; k++)
+                acc[k] = p[k];
+        }
+        else
+        {
+            for (int k = 0; k < n; k++)
+                acc[k] += p[k];
+        }
+    }
+
+    // each box adds up its column sums, scaled by 1 / (columns * rows) in Q23 (Q15 * Q16 >> 8): at most 255 << 23
+    uint32_t r = plan->ry[i];
+    if (config->channels == 1)
+    {
+        for (int j = 0; j < tw; j++)
+        {
+            const uint32_t *q = acc + plan->col[j];
+            uint32_t s = 0;
+            for (int x = 0; x < plan->wx[j]; x++)
+                s += q[x];
+            uint32_t scale = (plan->rx[j] * r) >> 8;
+            uint32_t v = (s * scale + (1 << 22)) >> 23;
+            v = v > 255 ? 255 : v;
+            out[j] = config->qtable ? (uint8_t)config->qtable[v] : v;
+        }
+    }
+    else
+    {
+        for (int j = 0; j < tw; j++)
+        {
+            const uint32_t *q = acc + plan->col[j] * 3;
+            uint32_t s0 = 0, s1 = 0, s2 = 0;
+            for (int x = 0; x < plan->wx[j]; x++, q += 3)
+            {
+                s0 += q[0];
+                s1 += q[1];
+                s2 += q[2];
+            }
+            uint32_t scale = (plan->rx[j] * r) >> 8;
+            uint32_t v0 = (s0 * scale + (1 << 22)) >> 23;
+            uint32_t v1 = (s1 * scale + (1 << 22)) >> 23;
+            uint32_t v2 = (s2 * scale + (1 << 22)) >> 23;
+            v0 = v0 > 255 ? 255 : v0;
+            v1 = v1 > 255 ? 255 : v1;
+            v2 = v2 > 255 ? 255 : v2;
+            if (config->qtable)
+            {
+                out[j * 3 + 0] = (uint8_t)config->qtable[v0];
+                out[j * 3 + 1] = (uint8_t)config->qtable[v1];
+                out[j * 3 + 2] = (uint8_t)config->qtable[v2];
+            }
+            else
+            {
+                out[j * 3 + 0] = v0;
+                out[j * 3 + 1] = v1;
+                out[j * 3 + 2] = v2;
+            }
+        }
+    }
+}
+
+/* with a streaming source, wait until every source row content row i reads from has arrived */
+static inline void isp_wait_rows(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, int i)
+{
+    int need;
+
+    if (config->source_rows == NULL)
+    {
+        return;
+    }
+    switch (plan->filter)
+    {
+    case ISP_FILTER_BILINEAR:
+        need = (int)plan->row[i] + 2 < plan->y0 + plan->rh ? (int)plan->row[i] + 2 : plan->y0 + plan->rh;
+        break;
+    case ISP_FILTER_AREA:
+        need = plan->row[i] + plan->wy[i];
+        break;
+    default:
+        need = plan->row[i] + 1;
+        break;
+    }
+    if (need > work->ready)
+    {
+        work->ready = config->source_rows(config->source_ctx, need);
+    }
+}
+
+/* convert rows [i0, i1) of the resampled frame, which sits at (ox, oy) in the target */
+static void isp_convert_rows(const isp_config_t *config, const isp_plan_t *plan, isp_work_t *work, uint8_t *pdst, const uint8_t *psrc, int i0, int i1)
+{
+    isp_row_t row;
+    int c = config->channels;
+    int th = config->th, tw = config->tw;
+    int ox = plan->ox, oy = plan->oy, cw = plan->cw;
+
+    switch (plan->filter)
+    {
+    case ISP_FILTER_BILINEAR:
+        row = row_bilinear;
+        break;
+    case ISP_FILTER_AREA:
+        row = row_area;
+        break;
+    default:
+        row = row_nearest;
+        break;
+    }
+
+    // a new frame, nothing filtered yet
+    work->htag[0] = -1;
+    work->htag[1] = -1;
+    work->ready = 0;
+
+    switch (config->rotation)
+    {
+    case ROTATION_LEFT:
+        for (int i = i0; i < i1; i++)
+        {
+            isp_wait_rows(config, plan, work, i);
+            row(config, plan, work, psrc, i, work->line);
+            store_left(pdst, work->line, oy + i, ox, cw, th, tw, c);
+        }
+        break;
+    case ROTATION_RIGHT:
+        for (int i = i0; i < i1; i++)
+        {
+            isp_wait_rows(config, plan, work, i);
+            row(config, plan, work, psrc, i, work->line);
+            store_right(pdst, work->line, oy + i, ox, cw, th, tw, c);
+        }
+        break;
+    case ROTATION_DOWN:
+        for (int i = i0; i < i1; i++)
+        {
+            isp_wait_rows(config, plan, work, i);
+            row(config, plan, work, psrc, i, work->line);
+            store_down(pdst, work->line, oy + i, ox, cw, th, tw, c);
+        }
+        break;
+    default:
+        // upright rows go straight to their place
+        for (int i = i0; i < i1; i++)
+        {
+            isp_wait_rows(config, plan, work, i);
+            row(config, plan, work, psrc, i, pdst + ((oy + i) * tw + ox) * c);
+        }
+        break;
+    }
+}
+
+#if ISP_PARALLEL
+/* the persistent second-core worker, it converts the rows it is handed and signals done */
+static struct
+{
+    TaskHandle_t task;
+    SemaphoreHandle_t lock; /* one split conversion at a time */
+    SemaphoreHandle_t done; /* barrier: the worker finished its rows */
+    const isp_config_t *config;
+    isp_plan_t *plan;
+    uint8_t *pdst;
+    const uint8_t *psrc;
+    int i0, i1;
+} isp_worker;
+
+static void isp_worker_task(void *arg)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        isp_convert_rows(isp_worker.config, isp_worker.plan, &isp_worker.plan->work[1], isp_worker.pdst,
+                         isp_worker.psrc, isp_worker.i0, isp_worker.i1);
+        xSemaphoreGive(isp_worker.done);
+    }
+}
+
+/* the worker runs the rows at the priority of the pipeline stages it splits the work of */
+#define ISP_WORKER_PRIORITY 5
+#endif
+
+/* write the padding around the letterboxed frame */
+static void isp_fill_pad(const isp_config_t *config, const isp_plan_t *plan, uint8_t *pdst, uint8_t value)
+{
+    int c = config->channels;
+    int th = config->th, tw = config->tw;
+
+    for (int i = 0; i < th; i++)
+    {
+        int inside = i >= plan->oy && i < plan->oy + plan->ch;
+        for (int j = 0; j < tw; j++)
+        {
+            int index;
+
+            if (inside && j == plan->ox)
+            {
+                j += plan->cw - 1;
+                continue;
+            }
+            switch (config->rotation)
+            {
+            case ROTATION_LEFT:
+                index = (tw - 1 - j) * th + i;
+                break;
+            case ROTATION_RIGHT:
+                index = j * th + (th - 1 - i);
+                break;
+            case ROTATION_DOWN:
+                index = (th - 1 - i) * tw + (tw - 1 - j);
+                break;
+            default:
+                index = i * tw + j;
+                break;
+            }
+            for (int k = 0; k < c; k++)
+                pdst[index * c + k] = value;
+        }
+    }
+}
+
+/* true if pdst already has its padding in byte, else it is noted as having it from now on */
+static int isp_pad_kept(isp_plan_t *plan, void *pdst, int byte)
+{
+    for (int i = 0; i < ISP_PAD_BUFFERS; i++)
+    {
+        if (plan->pad[i].dst == pdst)
+        {
+            int kept = plan->pad[i].byte == byte;
+            plan->pad[i].byte = byte;
+            return kept;
+        }
+    }
+    // a new buffer takes the place of the one noted longest ago
+    plan->pad[plan->pad_next].dst = pdst;
+    plan->pad[plan->pad_next].byte = byte;
+    plan->pad_next = (plan->pad_next + 1) % ISP_PAD_BUFFERS;
+    return 0;
+}
+
+/* source tap of target index j and the weight of its next neighbour, pixel centres aligned */
+static void bilinear_tap(int j, int n, int tn, uint32_t *start, uint16_t *weight)
+{
+    int64_t pos = ((int64_t)(2 * j + 1) * n * 256 + tn) / (2 * tn) - 128;
+
+    if (pos < 0)
+        pos = 0;
+    *start = (uint32_t)(pos >> 8);
+    *weight = (uint16_t)(pos & 0xFF);
+    if (*start >= (uint32_t)n - 1)
+    {
+        *start = n - 1;
+        *weight = 0;
+    }
+}
+
+/* source span covered by target index j */
+static void area_span(int j, int n, int tn, uint32_t *start, uint16_t *count)
+{
+    uint32_t s = (uint64_t)j * n / tn;
+    uint32_t e = (uint64_t)(j + 1) * n / tn;
+
+    if (e <= s)
+        e = s + 1;
+    *start = s;
+    *count = e - s;
+}
+
+static void isp_work_free(isp_work_t *work)
+{
+    free(work->line);
+    free(work->dec[0]);
+    free(work->dec[1]);
+    free(work->hrow[0]);
+    free(work->hrow[1]);
+    free(work->acc);
+    memset(work, 0, sizeof(isp_work_t));
+}
+
+static int isp_work_alloc(isp_work_t *work, int wide, int tw)
+{
+    work->line = (uint8_t *)malloc(tw * 3);
+    work->dec[0] = (uint8_t *)malloc(wide * 3);
+    work->dec[1] = (uint8_t *)malloc(wide * 3);
+    work->hrow[0] = (uint16_t *)malloc(tw * 3 * sizeof(uint16_t));
+    work->hrow[1] = (uint16_t *)malloc(tw * 3 * sizeof(uint16_t));
+    work->acc = (uint32_t *)malloc(wide * 3 * sizeof(uint32_t));
+    if (work->line == NULL || work->dec[0] == NULL || work->dec[1] == NULL || work->hrow[0] == NULL ||
+        work->hrow[1] == NULL || work->acc == NULL)
+    {
+        isp_work_free(work);
+        return -1;
+    }
+    return 0;
+}
+
+static void isp_plan_free(isp_plan_t *plan)
+{
+    if (plan)
+    {
+        free(plan->row);
+        free(plan->wy);
+        free(plan->ry);
+        free(plan->col);
+        free(plan->col1);
+        free(plan->wx);
+        free(plan->rx);
+        isp_work_free(&plan->work[0]);
+        isp_work_free(&plan->work[1]);
+        free(plan);
+    }
+}
+
+/* tables for th x tw targets from frames w wide, whatever region of them is sampled */
+static isp_plan_t *isp_plan_alloc(int w, int th, int tw)
+{
+    isp_plan_t *plan = (isp_plan_t *)calloc(1, sizeof(isp_plan_t));
+    if (plan == NULL)
+    {
+        return NULL;
+    }
+    plan->w = w;
+    plan->th = th;
+    plan->tw = tw;
+    plan->wide = w > tw ? w : tw;
+    plan->row = (uint32_t *)malloc(th * sizeof(uint32_t));
+    plan->wy = (uint16_t *)malloc(th * sizeof(uint16_t));
+    plan->ry = (uint32_t *)malloc(th * sizeof(uint32_t));
+    plan->col = (uint16_t *)malloc(tw * sizeof(uint16_t));
+    plan->col1 = (uint16_t *)malloc(plan->wide * sizeof(uint16_t));
+    plan->wx = (uint16_t *)malloc(tw * sizeof(uint16_t));
+    plan->rx = (uint32_t *)malloc(tw * sizeof(uint32_t));
+    if (plan->row == NULL || plan->wy == NULL || plan->ry == NULL || plan->col == NULL || plan->col1 == NULL ||
+        plan->wx == NULL || plan->rx == NULL || isp_work_alloc(&plan->work[0], plan->wide, tw) != 0)
+    {
+        isp_plan_free(plan);
+        return NULL;
+    }
+    return plan;
+}
+
+static isp_plan_t *isp_plan_get(isp_config_t *config)
+{
+    isp_plan_t *plan = config->plan;
+    int h = config->h, w = config->w;
+    int th = config->th, tw = config->tw;
+
+    if (plan && plan->h == h && plan->w == w && plan->th == th && plan->tw == tw && plan->filter == config->filter &&
+        plan->letterbox == config->letterbox && plan->rotation == config->rotation &&
+        memcmp(&plan->roi, &config->roi, sizeof(isp_rect_t)) == 0)
+    {
+        return plan;
+    }
+
+    // the buffers only depend on the frame width and the target, a new region (a cascade crops a
+    // box per call) rebuilds the tables in place without going through the heap
+    if (plan == NULL || plan->w != w || plan->th != th || plan->tw != tw)
+    {
+        isp_plan_free(plan);
+        plan = isp_plan_alloc(w, th, tw);
+        config->plan = plan;
+        if (plan == NULL)
+        {
+            return NULL;
+        }
+    }
+    // not a valid key until the tables are complete
+    plan->h = 0;
+    plan->filter = config->filter;
+    plan->letterbox = config->letterbox;
+    plan->rotation = config->rotation;
+
+    // only the region of interest is sampled, clipped to the frame
+    plan->x0 = 0;
+    plan->y0 = 0;
+    plan->rw = w;
+    plan->rh = h;
+    if (config->roi.w > 0 && config->roi.h > 0)
+    {
+        int x1 = config->roi.x + config->roi.w < w ? config->roi.x + config->roi.w : w;
+        int y1 = config->roi.y + config->roi.h < h ? config->roi.y + config->roi.h : h;
+        plan->x0 = config->roi.x > 0 ? config->roi.x : 0;
+        plan->y0 = config->roi.y > 0 ? config->roi.y : 0;
+        plan->rw = x1 - plan->x0;
+        plan->rh = y1 - plan->y0;
+        if (plan->rw <= 0 || plan->rh <= 0)
+        {
+            return NULL;
+        }
+    }
+    h = plan->rh;
+    w = plan->rw;
+
+    // the frame is resampled to cw x ch, letterboxing shrinks one side to keep the aspect ratio
+    plan->cw = tw;
+    plan->ch = th;
+    if (config->letterbox)
+    {
+        if ((int64_t)w * th >= (int64_t)h * tw)
+            plan->ch = ((int64_t)h * tw + w / 2) / w;
+        else
+            plan->cw = ((int64_t)w * th + h / 2) / h;
+        plan->cw = plan->cw > 0 ? plan->cw : 1;
+        plan->ch = plan->ch > 0 ? plan->ch : 1;
+    }
+    plan->ox = (tw - plan->cw) / 2;
+    plan->oy = (th - plan->ch) / 2;
+    plan->transform.x0 = plan->x0;
+    plan->transform.y0 = plan->y0;
+    plan->transform.ox = plan->ox;
+    plan->transform.oy = plan->oy;
+    plan->transform.cw = plan->cw;
+    plan->transform.ch = plan->ch;
+    plan->transform.sx = (((int64_t)w << 16) + plan->cw / 2) / plan->cw;
+    plan->transform.sy = (((int64_t)h << 16) + plan->ch / 2) / plan->ch;
+    // a new layout, no buffer has its padding
+    memset(plan->pad, 0, sizeof(plan->pad));
+    plan->pad_next = 0;
+    th = plan->ch;
+    tw = plan->cw;
+
+    for (int i = 0; i < th; i++)
+    {
+        switch (plan->filter)
+        {
+        case ISP_FILTER_BILINEAR:
+            bilinear_tap(i, h, th, &plan->row[i], &plan->wy[i]);
+            plan->row[i] += plan->y0;
+            break;
+        case ISP_FILTER_AREA:
+            area_span(i, h, th, &plan->row[i], &plan->wy[i]);
+            plan->row[i] += plan->y0;
+            plan->ry[i] = (65536 + plan->wy[i] / 2) / plan->wy[i];
+            break;
+        default:
+            // nearest neighbour: floor(i * h / th), computed once instead of per pixel
+            plan->row[i] = plan->y0 + (uint32_t)i * h / th;
+            break;
+        }
+    }
+    for (int j = 0; j < tw; j++)
+    {
+        uint32_t start;
+        switch (plan->filter)
+        {
+        case ISP_FILTER_BILINEAR:
+            bilinear_tap(j, w, tw, &start, &plan->wx[j]);
+            plan->col[j] = plan->x0 + start;
+            plan->col1[j] = plan->x0 + (start + 1 < (uint32_t)w ? start + 1 : start);
+            break;
+        case ISP_FILTER_AREA:
+            area_span(j, w, tw, &start, &plan->wx[j]);
+            plan->col[j] = start;
+            plan->rx[j] = (32768 + plan->wx[j] / 2) / plan->wx[j];
+            break;
+        default:
+            plan->col[j] = plan->x0 + (uint32_t)j * w / tw;
+            break;
+        }
+    }
+    plan->contiguous = plan->filter == ISP_FILTER_NEAREST && tw == w;
+    if (plan->filter == ISP_FILTER_AREA)
+    {
+        // the region's part of each source row is decoded, the box sums pick from it
+        for (int x = 0; x < w; x++)
+            plan->col1[x] = plan->x0 + x;
+    }
+
+    plan->h = config->h;
+    plan->roi = config->roi;
+    return plan;
+}
+
+int isp_convert(void *pdst, const uint8_t *psrc, isp_config_t *config)
+{
+    if (config->channels != 1 && config->channels != 3)
+    {
+        return -1;
+    }
+    if (config->h <= 0 || config->w <= 0 || config->w > 0xFFFF || config->th <= 0 || config->tw <= 0)
+    {
+        return -1;
+    }
+    if (config->filter > ISP_FILTER_AREA || isp_decoder(config) == NULL)
+    {
+        return -1;
+    }
+    if (config->source_rows && config->format == ISP_FORMAT_YUV422P)
+    {
+        // the chroma planes only arrive after the last row
+        return -1;
+    }
+
+    isp_plan_t *plan = isp_plan_get(config);
+    if (plan == NULL)
+    {
+        return -1;
+    }
+
+    if (config->letterbox)
+    {
+        uint8_t pad = config->qtable ? (uint8_t)config->qtable[config->pad] : config->pad;
+        if (!config->keep_pad || !isp_pad_kept(plan, pdst, pad))
+        {
+            isp_fill_pad(config, plan, (uint8_t *)pdst, pad);
+        }
+    }
+
+#if ISP_PARALLEL
+    // the lower half of the rows goes to the worker on the other core, if isp_worker_init() created it
+    if (config->parallel && plan->ch > 1 && isp_worker.task && xPortGetCoreID() != CONFIG_ISP_WORKER_CORE &&
+        (plan->work[1].line || isp_work_alloc(&plan->work[1], plan->wide, plan->cw) == 0))
+    {
+        int split = plan->ch / 2;
+
+        xSemaphoreTake(isp_worker.lock, portMAX_DELAY);
+        isp_worker.config = config;
+        isp_worker.plan = plan;
+        isp_worker.pdst = (uint8_t *)pdst;
+        isp_worker.psrc = psrc;
+        isp_worker.i0 = split;
+        isp_worker.i1 = plan->ch;
+        xTaskNotifyGive(isp_worker.task);
+        isp_convert_rows(config, plan, &plan->work[0], (uint8_t *)pdst, psrc, 0, split);
+        xSemaphoreTake(isp_worker.done, portMAX_DELAY);
+        xSemaphoreGive(isp_worker.lock);
+    }
+    else
+#endif
+    {
+        isp_convert_rows(config, plan, &plan->work[0], (uint8_t *)pdst, psrc, 0, plan->ch);
+    }
+    config->transform = plan->transform;
+
+    return 0;
+}
+
+int isp_worker_init(void)
+{
+#if ISP_PARALLEL
+    static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+    static StaticSemaphore_t lock_buffer;
+    int ret = 0;
+
+    // the lock is created under a spinlock, without allocating, so models initialising on both cores share one
+    taskENTER_CRITICAL(&spinlock);
+    if (isp_worker.lock == NULL)
+        isp_worker.lock = xSemaphoreCreateMutexStatic(&lock_buffer);
+    taskEXIT_CRITICAL(&spinlock);
+
+    xSemaphoreTake(isp_worker.lock, portMAX_DELAY);
+    if (isp_worker.task == NULL)
+    {
+        if (isp_worker.done == NULL)
+            isp_worker.done = xSemaphoreCreateBinary();
+        if (isp_worker.done == NULL ||
+            xTaskCreatePinnedToCore(isp_worker_task, "isp", 2 * 1024, NULL, ISP_WORKER_PRIORITY, &isp_worker.task,
+                                    CONFIG_ISP_WORKER_CORE) != pdPASS)
+        {
+            isp_worker.task = NULL;
+            ret = -1;
+        }
+    }
+    xSemaphoreGive(isp_worker.lock);
+    return ret;
+#else
+    return 0;
+#endif
+}
+
+void isp_release(isp_config_t *config)
+{
+    isp_plan_free(config->plan);
+    config->plan = NULL;
+}
+
+void isp_quant_table(int8_t *qtable, float scale, int zero_point)
+{
+    for (int v = 0; v < 256; v++)
+    {
+        int32_t q;
+        if (scale > 0)
+        {
+            float f = (float)v / 255.0f / scale;
+            q = (int32_t)(f + 0.5f) + zero_point;
+        }
+        else
+        {
+            q = v - 128;
+        }
+        qtable[v] = (int8_t)(q > 127 ? 127 : (q < -128 ? -128 : q));
+    }
+}
+
+/* one conversion through a plan of its own, so the wrappers stay reentrant */
+static int isp_convert_legacy(uint8_t format, uint8_t channels, void *pdst, const uint8_t *psrc, int h, int w, int th,
+                              int tw, uint8_t rotation, const int8_t *qtable)
+{
+    isp_config_t config = {.format = format, .channels = channels, .rotation = rotation, .h = h, .w = w, .th = th,
+                           .tw = tw, .qtable = qtable};
+    int ret = isp_convert(pdst, psrc, &config);
+    isp_release(&config);
+    return ret;
+}
+
+int yuv422p_to_rgb888(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation)
+{
+    return isp_convert_legacy(ISP_FORMAT_YUV422P, 3, pdst, psrc, h, w, th, tw, rotation, NULL);
+}
+
+int yuv422p_to_gray(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation)
+{
+    return isp_convert_legacy(ISP_FORMAT_YUV422P, 1, pdst, psrc, h, w, th, tw, rotation, NULL);
+}
+
+int yuv422_to_rgb888(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation)
+{
+    return isp_convert_legacy(ISP_FORMAT_YUV422, 3, pdst, psrc, h, w, th, tw, rotation, NULL);
+}
+
+int yuv422_to_gray(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation)
+{
+    return isp_convert_legacy(ISP_FORMAT_YUV422, 1, pdst, psrc, h, w, th, tw, rotation, NULL);
+}
+
+int rgb565_to_rgb888(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation)
+{
+    return isp_convert_legacy(ISP_FORMAT_RGB565, 3, pdst, psrc, h, w, th, tw, rotation, NULL);
+}
+
+int rgb565_to_gray(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation)
+{
+    return isp_convert_legacy(ISP_FORMAT_RGB565, 1, pdst, psrc, h, w, th, tw, rotation, NULL);
+}
+
+int rgb565_to_rgb888_int8(int8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation, const int8_t *qtable)
+{
+    return isp_convert_legacy(ISP_FORMAT_RGB565, 3, pdst, psrc, h, w, th, tw, rotation, qtable);
+}
+
+int rgb565_to_gray_int8(int8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation, const int8_t *qtable)
+{
+    return isp_convert_legacy(ISP_FORMAT_RGB565, 1, pdst, psrc, h, w, th, tw, rotation, qtable);
+}
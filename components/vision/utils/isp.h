@@ -0,0 +1,192 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      isp.h
+* @brief
+* @author    Hongtai Liu (lht856@foxmail.com)
+* @date      2022-05-19
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#ifndef ISP_H
+#define ISP_H
+
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    enum ROTATION
+    {
+        ROTATION_UP,
+        ROTATION_LEFT,
+        ROTATION_RIGHT,
+        ROTATION_DOWN
+    };
+
+    enum ISP_FORMAT
+    {
+        ISP_FORMAT_RGB565,
+        ISP_FORMAT_YUV422P, /* planar: Y plane, then U and V planes */
+        ISP_FORMAT_YUV422,  /* packed: Y0 U Y1 V, as the sensor sends it */
+        ISP_FORMAT_RGB888,
+        ISP_FORMAT_GRAY
+    };
+
+    enum ISP_FILTER
+    {
+        ISP_FILTER_NEAREST,  /* fastest, aliases when shrinking a lot */
+        ISP_FILTER_BILINEAR, /* 2x2 taps, pixel centres aligned */
+        ISP_FILTER_AREA      /* box average over the covered source pixels, best for downscaling */
+    };
+
+#if defined(CONFIG_ISP_FILTER_BILINEAR)
+#define ISP_FILTER_DEFAULT ISP_FILTER_BILINEAR
+#elif defined(CONFIG_ISP_FILTER_AREA)
+#define ISP_FILTER_DEFAULT ISP_FILTER_AREA
+#else
+#define ISP_FILTER_DEFAULT ISP_FILTER_NEAREST
+#endif
+
+    typedef struct isp_plan isp_plan_t;
+
+    /*
+     * Streaming source: block until at least `rows` rows of the frame are in
+     * memory and return how many are. Rows are requested in increasing order,
+     * from both cores in parallel mode.
+     */
+    typedef int (*isp_source_rows_t)(void *ctx, int rows);
+
+    typedef struct
+    {
+        int x, y;
+        int w, h;
+    } isp_rect_t;
+
+    /* where the source region ended up in the target, see isp_source_x() and friends */
+    typedef struct
+    {
+        int x0, y0;     /* top-left corner of the region inside the source */
+        int ox, oy;     /* top-left corner of the region inside the target */
+        int cw, ch;     /* size of the region inside the target */
+        int32_t sx, sy; /* source pixels per target pixel, Q16 */
+    } isp_transform_t;
+
+    /**
+     * @brief Description of one resize + colour conversion job
+     *
+     * The sampling tables are built on the first isp_convert() call and kept in
+     * `plan` until the geometry changes, so keep one config per call site and
+     * zero-initialise it before use.
+     */
+    typedef struct
+    {
+        uint8_t format;       /* ISP_FORMAT_* of the source */
+        uint8_t channels;     /* 1 for gray, 3 for RGB888 */
+        uint8_t rotation;     /* ROTATION_* applied to the target */
+        uint8_t filter;       /* ISP_FILTER_* used for resampling */
+        uint8_t letterbox;    /* keep the aspect ratio, fill the rest of the target with pad */
+        uint8_t pad;          /* padding pixel value, goes through qtable like the pixels */
+        uint8_t keep_pad;     /* nothing else writes to pdst, write its padding only once (a few buffers are remembered) */
+        uint8_t parallel;     /* split the rows with the worker of isp_worker_init() (CONFIG_ISP_PARALLEL) */
+        int h, w;             /* source size */
+        isp_rect_t roi;       /* source region to convert, clipped to the frame; zero size for the whole frame */
+        int th, tw;           /* target size, before rotation */
+        const int8_t *qtable; /* int8 output through this table, NULL for uint8 output */
+        isp_source_rows_t source_rows; /* NULL when the whole frame is in memory */
+        void *source_ctx;
+        isp_transform_t transform; /* filled by isp_convert() */
+        isp_plan_t *plan;     /* cached sampling tables, owned by isp */
+    } isp_config_t;
+
+    /* map a target (model input) position or length back to the source frame */
+    static inline int isp_source_x(const isp_transform_t *t, int x)
+    {
+        return t->x0 + (int32_t)(((int64_t)(x - t->ox) * t->sx + 0x8000) >> 16);
+    }
+
+    static inline int isp_source_y(const isp_transform_t *t, int y)
+    {
+        return t->y0 + (int32_t)(((int64_t)(y - t->oy) * t->sy + 0x8000) >> 16);
+    }
+
+    static inline int isp_source_w(const isp_transform_t *t, int w)
+    {
+        return (int32_t)(((int64_t)w * t->sx + 0x8000) >> 16);
+    }
+
+    static inline int isp_source_h(const isp_transform_t *t, int h)
+    {
+        return (int32_t)(((int64_t)h * t->sy + 0x8000) >> 16);
+    }
+
+    /**
+     * @brief Resize and convert one frame
+     *
+     * @param pdst    th * tw * channels bytes, uint8_t or int8_t (see qtable)
+     * @param psrc    source frame
+     * @param config  job description, its plan is (re)built when needed
+     * @return 0 on success, -1 on invalid config (or an roi outside the frame) or out of memory
+     */
+    int isp_convert(void *pdst, const uint8_t *psrc, isp_config_t *config);
+
+    /* free the cached plan of a config */
+    void isp_release(isp_config_t *config);
+
+    /*
+     * Create the worker of parallel conversions on CONFIG_ISP_WORKER_CORE, once
+     * however many callers: call it from init, conversions never start it
+     * themselves. 0 on success or without CONFIG_ISP_PARALLEL.
+     */
+    int isp_worker_init(void);
+
+    /* one-off conversions, 0 on success, -1 on bad arguments or out of memory */
+    int yuv422p_to_gray(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation);
+    int yuv422p_to_rgb888(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation);
+    int yuv422_to_gray(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation);
+    int yuv422_to_rgb888(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation);
+    int rgb565_to_gray(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation);
+    int rgb565_to_rgb888(uint8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation);
+
+    /* unpack n contiguous RGB565 pixels, bit-exact with rgb565_to_rgb888() and rgb565_to_gray() */
+    void rgb565_unpack_rgb888(uint8_t *pdst, const uint8_t *psrc, int n);
+    void rgb565_unpack_gray(uint8_t *pdst, const uint8_t *psrc, int n);
+
+    /* the kernels behind them, by table and word-parallel (CONFIG_ISP_RGB565_SWAR), both bit-exact */
+    void rgb565_unpack_rgb888_table(uint8_t *pdst, const uint8_t *psrc, int n);
+    void rgb565_unpack_gray_table(uint8_t *pdst, const uint8_t *psrc, int n);
+    void rgb565_unpack_rgb888_swar(uint8_t *pdst, const uint8_t *psrc, int n);
+    void rgb565_unpack_gray_swar(uint8_t *pdst, const uint8_t *psrc, int n);
+
+    /**
+     * @brief Build the pixel -> int8 lookup table of a quantized model input
+     *
+     * Pixels are normalised to [0, 1] and quantized with the input tensor's
+     * scale and zero point, so for the usual (1/255, -128) parameters the table
+     * is simply v - 128.
+     *
+     * @param qtable      256 entries, indexed by the 8-bit pixel value
+     * @param scale       input tensor scale, <= 0 falls back to v - 128
+     * @param zero_point  input tensor zero point
+     */
+    void isp_quant_table(int8_t *qtable, float scale, int zero_point);
+
+    /* resize, colour convert and quantize in a single pass into an int8 tensor, 0 on success */
+    int rgb565_to_gray_int8(int8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation, const int8_t *qtable);
+    int rgb565_to_rgb888_int8(int8_t *pdst, const uint8_t *psrc, int h, int w, int th, int tw, uint8_t rotation, const int8_t *qtable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,650 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      jpeg.c
+* @brief     Baseline JPEG decoding into model inputs
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "jpeg.h"
+
+#define HUFF_FAST_BITS 9
+
+#define CLIP(x) ((x) < 0 ? 0 : ((x) > 255 ? 255 : (x)))
+
+static const uint8_t _ZIGZAG[64] = {
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5, 12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+typedef struct
+{
+    uint8_t fast[1 << HUFF_FAST_BITS]; /* symbol index of the top bits, 255 for longer codes */
+    uint16_t code[256];
+    uint8_t values[256];
+    uint8_t size[257];
+    uint32_t maxcode[18];              /* first code of the next length, left aligned to 16 bits */
+    int delta[17];                     /* symbol index - code, per length */
+} huff_t;
+
+typedef struct
+{
+    uint8_t id;
+    uint8_t h, v;     /* sampling factors */
+    uint8_t tq;       /* quantization table */
+    uint8_t td, ta;   /* dc and ac huffman tables */
+    int pred;         /* dc predictor */
+    uint8_t *mcu;     /* the component's part of the current MCU, at the output scale */
+} jpeg_component_t;
+
+typedef struct
+{
+    const uint8_t *p, *end;
+    uint32_t buf;     /* left aligned */
+    int bits;
+    int marker;       /* marker hit in the entropy data, 0 if none */
+} jpeg_bits_t;
+
+struct jpeg_state
+{
+    uint16_t q[4][64];       /* zigzag order */
+    huff_t huff[2][4];       /* dc, ac */
+    jpeg_component_t comp[3];
+    int ncomp;
+    int width, height;
+    int hmax, vmax;
+    int restart;
+    const uint8_t *scan;     /* entropy coded data */
+    uint8_t mcu[3][16 * 16];
+};
+
+/* separable IDCT kernels, [x * n + u] = C(u) cos((2x + 1) u pi / 2n) / 2 in Q11 */
+static int16_t _IDCT_8[64], _IDCT_4[16], _IDCT_2[4];
+
+static void idct_tables(void)
+{
+    static int16_t *const tables[] = {_IDCT_8, _IDCT_4, _IDCT_2};
+    static const int sizes[] = {8, 4, 2};
+
+    if (_IDCT_8[0])
+    {
+        return;
+    }
+    for (int t = 2; t >= 0; t--)
+    {
+        int n = sizes[t];
+        for (int x = 0; x < n; x++)
+        {
+            for (int u = 0; u < n; u++)
+            {
+                double c = (u == 0 ? sqrt(0.5) : 1.0) * cos((2 * x + 1) * u * M_PI / (2 * n)) / 2;
+                tables[t][x * n + u] = (int16_t)lround(c * 2048);
+            }
+        }
+    }
+}
+
+static int huff_build(huff_t *h, const uint8_t *count, const uint8_t *values)
+{
+    int i, j, k = 0;
+    uint32_t code = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        for (j = 0; j < count[i]; j++)
+        {
+            if (k >= 256)
+                return -1;
+            h->size[k++] = i + 1;
+        }
+    }
+    h->size[k] = 0;
+    memcpy(h->values, values, k);
+
+    k = 0;
+    for (j = 1; j <= 16; j++)
+    {
+        h->delta[j] = k - code;
+        while (h->size[k] == j)
+            h->code[k++] = code++;
+        if (code > (1u << j))
+            return -1;
+        h->maxcode[j] = code << (16 - j);
+        code <<= 1;
+    }
+    h->maxcode[j] = 0xFFFFFFFF;
+
+    memset(h->fast, 255, sizeof(h->fast));
+    for (i = 0; i < k; i++)
+    {
+        int s = h->size[i];
+        if (s <= HUFF_FAST_BITS)
+        {
+            int c = h->code[i] << (HUFF_FAST_BITS - s);
+            for (j = 0; j < (1 << (HUFF_FAST_BITS - s)); j++)
+                h->fast[c + j] = i;
+        }
+    }
+    return 0;
+}
+
+/* top up the bit buffer, stuffed zeros are dropped and a marker ends the data (zeros are fed from there) */
+static void bits_fill(jpeg_bits_t *b)
+{
+    while (b->bits <= 24)
+    {
+        uint32_t c = 0;
+        if (!b->marker && b->p < b->end)
+        {
+            c = *b->p;
+            if (c == 0xFF)
+            {
+                int next = b->p + 1 < b->end ? b->p[1] : 0xD9;
+                if (next == 0)
+                {
+                    b->p += 2;
+                }
+                else
+                {
+                    b->marker = next;
+                    c = 0;
+                }
+            }
+            else
+            {
+                b->p++;
+            }
+        }
+        b->buf |= c << (24 - b->bits);
+        b->bits += 8;
+    }
+}
+
+static inline int bits_get(jpeg_bits_t *b, int n)
+{
+    if (n == 0)
+        return 0;
+    if (b->bits < n)
+        bits_fill(b);
+    int v = b->buf >> (32 - n);
+    b->buf <<= n;
+    b->bits -= n;
+    return v;
+}
+
+static inline int bits_extend(int v, int n)
+{
+    return v < (1 << (n - 1)) ? v - (1 << n) + 1 : v;
+}
+
+static int huff_decode(jpeg_bits_t *b, const huff_t *h)
+{
+    int k;
+
+    if (b->bits < 16)
+        bits_fill(b);
+
+    k = h->fast[b->buf >> (32 - HUFF_FAST_BITS)];
+    if (k < 255)
+    {
+        int s = h->size[k];
+        b->buf <<= s;
+        b->bits -= s;
+        return h->values[k];
+    }
+
+    uint32_t t = b->buf >> 16;
+    for (k = HUFF_FAST_BITS + 1; k <= 16 && t >= h->maxcode[k]; k++)
+        ;
+    if (k > 16)
+        return -1;
+    int c = (b->buf >> (32 - k)) + h->delta[k];
+    b->buf <<= k;
+    b->bits -= k;
+    return h->values[c];
+}
+
+/* skip to the data after the next RSTn */
+static void bits_restart(jpeg_bits_t *b)
+{
+    if (!b->marker)
+    {
+        while (b->p + 1 < b->end && !(b->p[0] == 0xFF && b->p[1] >= 0xD0 && b->p[1] <= 0xD7))
+            b->p++;
+    }
+    if (b->p + 1 < b->end && b->p[0] == 0xFF && b->p[1] >= 0xD0 && b->p[1] <= 0xD7)
+        b->p += 2;
+    b->buf = 0;
+    b->bits = 0;
+    b->marker = 0;
+}
+
+/*
+ * A dequantized coefficient, saturated: those of 8-bit samples stay within
+ * about 1024, and up to 2^13 both IDCT passes keep their sums in 32 bits.
+ * Only a corrupt stream (or 16-bit tables) goes beyond.
+ */
+#define JPEG_COEF_MAX (1 << 13)
+
+static inline int32_t dequant(int v, uint16_t q)
+{
+    int32_t c = v * q; // |v| < 2^11 and q < 2^16
+    return c > JPEG_COEF_MAX ? JPEG_COEF_MAX : (c < -JPEG_COEF_MAX ? -JPEG_COEF_MAX : c);
+}
+
+/*
+ * Entropy decode one block into natural order, dequantized. Only the top-left
+ * n x n coefficients are kept, the ones the scaled IDCT reads; returns 1 if any
+ * of them is an AC coefficient, 0 for a flat block, -1 on corrupt data.
+ */
+static int decode_block(jpeg_bits_t *b, const huff_t *dc, const huff_t *ac, const uint16_t *q, int *pred, int32_t *coef, int n)
+{
+    int ac_seen = 0;
+    int t = huff_decode(b, dc);
+
+    if (t < 0 || t > 11)
+        return -1;
+    *pred += t ? bits_extend(bits_get(b, t), t) : 0;
+    // baseline DC coefficients have 11 bits
+    if (*pred < -2047 || *pred > 2047)
+        return -1;
+    coef[0] = dequant(*pred, q[0]);
+
+    for (int k = 1; k < 64; k++)
+    {
+        int rs = huff_decode(b, ac);
+        if (rs < 0)
+            return -1;
+        int r = rs >> 4, s = rs & 15;
+        if (s == 0)
+        {
+            if (r != 15)
+                break;
+            k += 15;
+            continue;
+        }
+        k += r;
+        // baseline AC coefficients have 10 bits
+        if (k > 63 || s > 10)
+            return -1;
+        int v = bits_extend(bits_get(b, s), s);
+        int z = _ZIGZAG[k];
+        if ((z & 7) < n && (z >> 3) < n)
+        {
+            coef[z] = dequant(v, q[k]);
+            ac_seen = 1;
+        }
+    }
+    return ac_seen;
+}
+
+/* n x n IDCT of the top-left coefficients into out, two Q11 passes with a Q3 intermediate */
+static void idct_block(int32_t *coef, int n, int ac, uint8_t *out, int stride)
+{
+    const int16_t *t = n == 8 ? _IDCT_8 : (n == 4 ? _IDCT_4 : _IDCT_2);
+    int32_t tmp[64];
+
+    if (!ac || n == 1)
+    {
+        // flat block, the mean is DC / 8
+        int v = CLIP(((coef[0] + 4) >> 3) + 128);
+        for (int y = 0; y < n; y++)
+            memset(out + y * stride, v, n);
+        return;
+    }
+
+    for (int u = 0; u < n; u++)
+    {
+        int nonzero = 0;
+        for (int v = 0; v < n; v++)
+            nonzero |= coef[v * 8 + u];
+        for (int y = 0; y < n; y++)
+        {
+            int32_t s = 0;
+            if (nonzero)
+            {
+                for (int v = 0; v < n; v++)
+                    s += t[y * n + v] * coef[v * 8 + u];
+            }
+            tmp[y * n + u] = s >> 8;
+        }
+    }
+    for (int y = 0; y < n; y++)
+    {
+        for (int x = 0; x < n; x++)
+        {
+            int32_t s = 0;
+            for (int u = 0; u < n; u++)
+                s += t[x * n + u] * tmp[y * n + u];
+            int v = ((s + (1 << 13)) >> 14) + 128;
+            out[y * stride + x] = CLIP(v);
+        }
+    }
+}
+
+static int jpeg_parse(jpeg_state_t *s, const uint8_t *jpg, size_t len)
+{
+    const uint8_t *p = jpg, *end = jpg + len;
+
+    if (len < 4 || p[0] != 0xFF || p[1] != 0xD8)
+        return -1;
+    p += 2;
+
+    s->ncomp = 0;
+    s->restart = 0;
+    while (p + 4 <= end)
+    {
+        if (*p != 0xFF)
+        {
+            p++;
+            continue;
+        }
+        int marker = p[1];
+        if (marker == 0xFF)
+        {
+            p++;
+            continue;
+        }
+        if (marker == 0xD8 || (marker >= 0xD0 && marker <= 0xD7) || marker == 0x01)
+        {
+            p += 2;
+            continue;
+        }
+        if (marker == 0xD9)
+            return -1;
+
+        int seg = (p[2] << 8) | p[3];
+        const uint8_t *q = p + 4, *qend = p + 2 + seg;
+        if (seg < 2 || qend > end)
+            return -1;
+
+        switch (marker)
+        {
+        case 0xDB: // DQT
+            while (q < qend)
+            {
+                int pq = q[0] >> 4, tq = q[0] & 15;
+                q++;
+                if (tq > 3 || q + (pq ? 128 : 64) > qend)
+                    return -1;
+                for (int k = 0; k < 64; k++, q += pq ? 2 : 1)
+                    s->q[tq][k] = pq ? (q[0] << 8) | q[1] : q[0];
+            }
+            break;
+        case 0xC4: // DHT
+            while (q + 17 <= qend)
+            {
+                int tc = q[0] >> 4, th = q[0] & 15, total = 0;
+                if (tc > 1 || th > 3)
+                    return -1;
+                for (int i = 0; i < 16; i++)
+                    total += q[1 + i];
+                if (q + 17 + total > qend || huff_build(&s->huff[tc][th], q + 1, q + 17) != 0)
+                    return -1;
+                q += 17 + total;
+            }
+            break;
+        case 0xC0: // baseline
+        case 0xC1: // extended sequential, huffman
+            if (seg < 8 || q[0] != 8)
+                return -1;
+            s->height = (q[1] << 8) | q[2];
+            s->width = (q[3] << 8) | q[4];
+            s->ncomp = q[5];
+            if (s->width == 0 || s->height == 0 || (s->ncomp != 1 && s->ncomp != 3) || seg < 8 + 3 * s->ncomp)
+                return -1;
+            s->hmax = s->vmax = 1;
+            for (int i = 0; i < s->ncomp; i++)
+            {
+                jpeg_component_t *c = &s->comp[i];
+                c->id = q[6 + i * 3];
+                c->h = q[7 + i * 3] >> 4;
+                c->v = q[7 + i * 3] & 15;
+                c->tq = q[8 + i * 3] & 3;
+                c->mcu = s->mcu[i];
+                if (c->h < 1 || c->h > 2 || c->v < 1 || c->v > 2)
+                    return -1;
+                s->hmax = c->h > s->hmax ? c->h : s->hmax;
+                s->vmax = c->v > s->vmax ? c->v : s->vmax;
+            }
+            break;
+        case 0xDD: // DRI
+            s->restart = (q[0] << 8) | q[1];
+            break;
+        case 0xDA: // SOS, only one interleaved scan of every component
+            if (s->ncomp == 0 || q[0] != s->ncomp)
+                return -1;
+            for (int i = 0; i < s->ncomp; i++)
+            {
+                int id = q[1 + i * 2], k;
+                for (k = 0; k < s->ncomp && s->comp[k].id != id; k++)
+                    ;
+                if (k == s->ncomp)
+                    return -1;
+                s->comp[k].td = q[2 + i * 2] >> 4 & 3;
+                s->comp[k].ta = q[2 + i * 2] & 3;
+            }
+            s->scan = qend;
+            return 0;
+        default:
+            // progressive, lossless and arithmetic coded frames are not supported, the rest is metadata
+            if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xCC)
+                return -1;
+            break;
+        }
+        p = qend;
+    }
+    return -1;
+}
+
+int jpeg_size(const uint8_t *jpg, size_t len, int *w, int *h)
+{
+    const uint8_t *p = jpg, *end = jpg + len;
+
+    if (len < 4 || p[0] != 0xFF || p[1] != 0xD8)
+        return -1;
+    p += 2;
+    while (p + 9 <= end)
+    {
+        if (p[0] != 0xFF || p[1] == 0xFF)
+        {
+            p++;
+            continue;
+        }
+        if (p[1] >= 0xC0 && p[1] <= 0xCF && p[1] != 0xC4 && p[1] != 0xC8 && p[1] != 0xCC)
+        {
+            *h = (p[5] << 8) | p[6];
+            *w = (p[7] << 8) | p[8];
+            return 0;
+        }
+        if (p[1] == 0xDA || p[1] == 0xD9)
+            return -1;
+        p += 2 + ((p[2] << 8) | p[3]);
+    }
+    return -1;
+}
+
+/* write the MCU at (mx, my) to the scaled image, upsampling chroma and converting to RGB888, or copying the luma */
+static void jpeg_store_mcu(const jpeg_state_t *s, uint8_t *image, int sw, int sh, int n, int mx, int my, int channels)
+{
+    int mw = s->hmax * n, mh = s->vmax * n;
+    int x0 = mx * mw, y0 = my * mh;
+    int cols = sw - x0 < mw ? sw - x0 : mw;
+    int rows = sh - y0 < mh ? sh - y0 : mh;
+    const jpeg_component_t *c = s->comp;
+
+    for (int y = 0; y < rows; y++)
+    {
+        const uint8_t *py = c[0].mcu + (y * c[0].v / s->vmax) * c[0].h * n;
+        uint8_t *out = image + ((y0 + y) * sw + x0) * channels;
+
+        if (channels == 1)
+        {
+            for (int x = 0; x < cols; x++)
+                out[x] = py[x * c[0].h / s->hmax];
+            continue;
+        }
+
+        const uint8_t *pb = c[1].mcu + (y * c[1].v / s->vmax) * c[1].h * n;
+        const uint8_t *pr = c[2].mcu + (y * c[2].v / s->vmax) * c[2].h * n;
+        for (int x = 0; x < cols; x++)
+        {
+            // JFIF YCbCr, Q16
+            int32_t Y = py[x * c[0].h / s->hmax] << 16;
+            int32_t cb = pb[x * c[1].h / s->hmax] - 128;
+            int32_t cr = pr[x * c[2].h / s->hmax] - 128;
+            int32_t r = (Y + 91881 * cr + 32768) >> 16;
+            int32_t g = (Y - 22554 * cb - 46802 * cr + 32768) >> 16;
+            int32_t b = (Y + 116130 * cb + 32768) >> 16;
+            out[x * 3 + 0] = CLIP(r);
+            out[x * 3 + 1] = CLIP(g);
+            out[x * 3 + 2] = CLIP(b);
+        }
+    }
+}
+
+/* entropy decode the scan, reconstructing only the MCUs that touch rows [0, ylim) x columns [xa, xb) of the scaled image */
+static int jpeg_decode(jpeg_state_t *s, const uint8_t *end, uint8_t *image, int scale, int channels, int xa, int xb, int ylim)
+{
+    int n = 8 / scale;
+    int sw = (s->width + scale - 1) / scale, sh = (s->height + scale - 1) / scale;
+    int mw = s->hmax * n, mh = s->vmax * n;
+    int mcux = (s->width + s->hmax * 8 - 1) / (s->hmax * 8);
+    int mcuy = (s->height + s->vmax * 8 - 1) / (s->vmax * 8);
+    int32_t coef[64];
+    int count = 0;
+    jpeg_bits_t b = {.p = s->scan, .end = end};
+
+    for (int i = 0; i < s->ncomp; i++)
+        s->comp[i].pred = 0;
+
+    for (int my = 0; my < mcuy && my * mh < ylim; my++)
+    {
+        for (int mx = 0; mx < mcux; mx++)
+        {
+            int keep = mx * mw < xb && (mx + 1) * mw > xa;
+
+            if (s->restart && count && count % s->restart == 0)
+            {
+                bits_restart(&b);
+                for (int i = 0; i < s->ncomp; i++)
+                    s->comp[i].pred = 0;
+            }
+            count++;
+
+            for (int i = 0; i < s->ncomp; i++)
+            {
+                jpeg_component_t *c = &s->comp[i];
+                // chroma of a gray input is decoded only to stay in sync
+                int idct = keep && (i == 0 || channels == 3);
+                for (int by = 0; by < c->v; by++)
+                {
+                    for (int bx = 0; bx < c->h; bx++)
+                    {
+                        memset(coef, 0, sizeof(coef));
+                        int ac = decode_block(&b, &s->huff[0][c->td], &s->huff[1][c->ta], s->q[c->tq], &c->pred, coef, idct ? n : 0);
+                        if (ac < 0)
+                            return -1;
+                        if (idct)
+                            idct_block(coef, n, ac, c->mcu + by * n * c->h * n + bx * n, c->h * n);
+                    }
+                }
+            }
+            if (keep)
+                jpeg_store_mcu(s, image, sw, sh, n, mx, my, channels);
+        }
+    }
+    return 0;
+}
+
+int jpeg_convert(void *pdst, const uint8_t *jpg, size_t len, isp_config_t *config, jpeg_decoder_t *decoder)
+{
+    if (decoder->state == NULL)
+    {
+        decoder->state = (jpeg_state_t *)calloc(1, sizeof(jpeg_state_t));
+        if (decoder->state == NULL)
+            return -1;
+    }
+    jpeg_state_t *s = decoder->state;
+    if (jpeg_parse(s, jpg, len) != 0)
+    {
+        return -1;
+    }
+    idct_tables();
+
+    // the region the model sees, in full-frame pixels
+    isp_rect_t roi = config->roi;
+    if (roi.w <= 0 || roi.h <= 0)
+    {
+        roi.x = 0;
+        roi.y = 0;
+        roi.w = s->width;
+        roi.h = s->height;
+    }
+
+    // largest scale that keeps at least the target resolution
+    int scale = 8;
+    while (scale > 1 && (roi.w / scale < config->tw || roi.h / scale < config->th))
+        scale >>= 1;
+
+    // gray frames stay gray here, isp expands them for RGB models
+    int channels = config->channels == 1 || s->ncomp == 1 ? 1 : 3;
+    int sw = (s->width + scale - 1) / scale, sh = (s->height + scale - 1) / scale;
+    size_t size = (size_t)sw * sh * channels;
+    if (decoder->size < size)
+    {
+        free(decoder->image);
+        decoder->image = (uint8_t *)malloc(size);
+        decoder->size = decoder->image ? size : 0;
+        if (decoder->image == NULL)
+            return -1;
+    }
+    decoder->width = s->width;
+    decoder->height = s->height;
+    decoder->scale = scale;
+
+    isp_rect_t scaled = {roi.x / scale, roi.y / scale, 0, 0};
+    scaled.w = (roi.x + roi.w + scale - 1) / scale - scaled.x;
+    scaled.h = (roi.y + roi.h + scale - 1) / scale - scaled.y;
+    if (jpeg_decode(s, jpg + len, decoder->image, scale, channels, scaled.x, scaled.x + scaled.w, scaled.y + scaled.h) != 0)
+    {
+        return -1;
+    }
+
+    // convert the scaled frame, then report the transform in full-frame pixels
+    isp_config_t job = *config;
+    job.format = channels == 1 ? ISP_FORMAT_GRAY : ISP_FORMAT_RGB888;
+    job.h = sh;
+    job.w = sw;
+    job.roi = config->roi.w > 0 && config->roi.h > 0 ? scaled : config->roi;
+    job.source_rows = NULL;
+    int ret = isp_convert(pdst, decoder->image, &job);
+    config->plan = job.plan;
+    if (ret != 0)
+    {
+        return -1;
+    }
+    config->transform = job.transform;
+    config->transform.x0 *= scale;
+    config->transform.y0 *= scale;
+    config->transform.sx *= scale;
+    config->transform.sy *= scale;
+    return 0;
+}
+
+void jpeg_release(jpeg_decoder_t *decoder)
+{
+    free(decoder->image);
+    free(decoder->state);
+    decoder->image = NULL;
+    decoder->state = NULL;
+    decoder->size = 0;
+}
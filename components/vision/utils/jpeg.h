@@ -0,0 +1,79 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      jpeg.h
+* @brief     Baseline JPEG decoding into model inputs
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#ifndef JPEG_H
+#define JPEG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "isp.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct jpeg_state jpeg_state_t;
+
+    /**
+     * @brief Scratch of a JPEG -> model input conversion
+     *
+     * Keep one per call site, zero-initialised, like isp_config_t. The buffers
+     * grow to the largest frame seen and are freed by jpeg_release().
+     */
+    typedef struct
+    {
+        int width, height;   /* size of the last frame */
+        uint8_t scale;       /* DCT scale it was decoded at: 1, 2, 4 or 8 */
+        uint8_t *image;      /* the frame at 1 / scale, RGB888 or gray */
+        size_t size;
+        jpeg_state_t *state; /* tables and parser state, owned by jpeg */
+    } jpeg_decoder_t;
+
+    /**
+     * @brief Read the frame size from the JPEG header
+     *
+     * @return 0 on success, -1 if no frame header is found
+     */
+    int jpeg_size(const uint8_t *jpg, size_t len, int *w, int *h);
+
+    /**
+     * @brief Decode a baseline JPEG straight into a model input
+     *
+     * The IDCT runs at the largest scale (1/8, 1/4, 1/2) that still leaves at
+     * least th x tw pixels of the source region, so the detail the resize
+     * would throw away is never reconstructed, and blocks outside the roi are
+     * only entropy decoded. The scaled frame then goes through isp_convert()
+     * with the caller's config (format, h, w and the streaming source are
+     * set here), so filter, roi, letterbox, rotation and quantization behave
+     * as for raw frames and config->transform maps back to the full frame.
+     * Gray model inputs only reconstruct the luma.
+     *
+     * @param pdst     th * tw * channels bytes, as for isp_convert()
+     * @param jpg      JPEG stream
+     * @param len      its length
+     * @param config   isp job, roi in full-frame coordinates
+     * @param decoder  scratch
+     * @return 0 on success, -1 on an unsupported (progressive, 12-bit,
+     *         arithmetic coded) or corrupt stream, or out of memory
+     */
+    int jpeg_convert(void *pdst, const uint8_t *jpg, size_t len, isp_config_t *config, jpeg_decoder_t *decoder);
+
+    /* free the buffers of a decoder */
+    void jpeg_release(jpeg_decoder_t *decoder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,347 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      track.c
+* @brief     SORT-style multi-object tracker in fixed point, without allocation
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#include <string.h>
+#include "track.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* noise of the filters in 1/256 pixel^2: detections are off by about 2 px, the speed changes slowly */
+#define TRACK_R (4 * 256)
+#define TRACK_Q_POS (1 * 256)
+#define TRACK_Q_VEL (64)
+/* the velocity of a new track is unknown, about 10 px/frame */
+#define TRACK_P_VEL (100 * 256)
+/* a track predicted for long stops growing its uncertainty here */
+#define TRACK_P_MAX (1 << 28)
+
+#define TRACK_INF (INT32_MAX / 2)
+
+static void axis_init(track_axis_t *axis, uint16_t z)
+{
+    axis->x = (int32_t)z << 4;
+    axis->v = 0;
+    axis->p00 = TRACK_R;
+    axis->p01 = 0;
+    axis->p11 = TRACK_P_VEL;
+}
+
+static void axis_predict(track_axis_t *axis)
+{
+    axis->x += axis->v;
+    axis->p00 = MIN(axis->p00 + 2 * axis->p01 + axis->p11 + TRACK_Q_POS, TRACK_P_MAX);
+    axis->p01 = MIN(axis->p01 + axis->p11, TRACK_P_MAX);
+    axis->p11 = MIN(axis->p11 + TRACK_Q_VEL, TRACK_P_MAX);
+}
+
+static void axis_update(track_axis_t *axis, uint16_t z)
+{
+    // gains in Q15, the one division per coordinate and update
+    int64_t s = (int64_t)axis->p00 + TRACK_R;
+    int64_t k0 = ((int64_t)axis->p00 << 15) / s;
+    int64_t k1 = ((int64_t)axis->p01 << 15) / s;
+    int64_t residual = ((int32_t)z << 4) - axis->x;
+
+    axis->x += (int32_t)((k0 * residual) >> 15);
+    axis->v += (int32_t)((k1 * residual) >> 15);
+    int32_t p01 = axis->p01;
+    axis->p00 -= (int32_t)((k0 * axis->p00) >> 15);
+    axis->p01 -= (int32_t)((k0 * p01) >> 15);
+    axis->p11 -= (int32_t)((k1 * p01) >> 15);
+}
+
+static uint16_t axis_value(const track_axis_t *axis, uint16_t min)
+{
+    int32_t value = (axis->x + 8) >> 4;
+    return (uint16_t)MIN(MAX(value, (int32_t)min), (int32_t)UINT16_MAX);
+}
+
+static detect_box_t track_box(const track_t *track)
+{
+    detect_box_t box;
+    box.x = axis_value(&track->axis[0], 0);
+    box.y = axis_value(&track->axis[1], 0);
+    box.w = axis_value(&track->axis[2], 1);
+    box.h = axis_value(&track->axis[3], 1);
+    box.confidence = track->confidence;
+    box.target = track->target;
+    return box;
+}
+
+static void track_start(tracker_t *tracker, const detect_box_t *box)
+{
+    track_t *track = &tracker->tracks[tracker->count++];
+    axis_init(&track->axis[0], box->x);
+    axis_init(&track->axis[1], box->y);
+    axis_init(&track->axis[2], box->w);
+    axis_init(&track->axis[3], box->h);
+    track->id = tracker->next_id;
+    track->hits = 1;
+    track->missed = 0;
+    track->confidence = box->confidence;
+    track->target = box->target;
+    tracker->next_id = tracker->next_id == UINT16_MAX ? 1 : tracker->next_id + 1;
+}
+
+static void track_correct(track_t *track, const detect_box_t *box)
+{
+    axis_update(&track->axis[0], box->x);
+    axis_update(&track->axis[1], box->y);
+    axis_update(&track->axis[2], box->w);
+    axis_update(&track->axis[3], box->h);
+    track->hits = track->hits == UINT16_MAX ? UINT16_MAX : track->hits + 1;
+    track->missed = 0;
+    track->confidence = box->confidence;
+    track->target = box->target;
+}
+
+static bool track_reported(const tracker_t *tracker, const track_t *track)
+{
+    return track->hits >= tracker->min_hits && track->missed == 0;
+}
+
+static int tracker_report(const tracker_t *tracker, track_object_t *out, int max_out)
+{
+    int n = 0;
+    for (uint8_t t = 0; t < tracker->count && n < max_out; t++)
+    {
+        if (track_reported(tracker, &tracker->tracks[t]))
+        {
+            out[n].box = track_box(&tracker->tracks[t]);
+            out[n].id = tracker->tracks[t].id;
+            n++;
+        }
+    }
+    return n;
+}
+
+/* best overlap first, each track and detection taken once */
+static void assign_greedy(tracker_t *tracker, int tracks, int boxes, uint16_t min_overlap)
+{
+    bool *taken = tracker->used;
+    memset(taken, 0, boxes * sizeof(bool));
+    while (true)
+    {
+        int bt = -1, bd = -1;
+        uint16_t best = 0;
+        for (int t = 0; t < tracks; t++)
+        {
+            for (int d = 0; d < boxes && tracker->match[t] < 0; d++)
+            {
+                uint16_t overlap = tracker->overlap[t][d];
+                if (!taken[d] && overlap && overlap >= min_overlap && (bt < 0 || overlap > best))
+                {
+                    bt = t;
+                    bd = d;
+                    best = overlap;
+                }
+            }
+        }
+        if (bt < 0)
+        {
+            return;
+        }
+        tracker->match[bt] = (int8_t)bd;
+        taken[bd] = true;
+    }
+}
+
+/*
+ * Hungarian method with potentials over the square matrix of 1 - IoU,
+ * padded with pairs of no overlap, O(n^3) for n the larger side.
+ */
+static void assign_hungarian(tracker_t *tracker, int tracks, int boxes, uint16_t min_overlap)
+{
+    const int n = MAX(tracks, boxes);
+    int32_t *u = tracker->u, *v = tracker->v, *minv = tracker->minv;
+    int8_t *p = tracker->p, *way = tracker->way;
+    bool *used = tracker->used;
+
+#define COST(i, j) ((i) <= tracks && (j) <= boxes ? 32768 - (int32_t)tracker->overlap[(i)-1][(j)-1] : 32768)
+
+    for (int j = 0; j <= n; j++)
+    {
+        u[j] = 0;
+        v[j] = 0;
+        p[j] = 0;
+        way[j] = 0;
+    }
+    for (int i = 1; i <= n; i++)
+    {
+        p[0] = (int8_t)i;
+        int j0 = 0;
+        for (int j = 0; j <= n; j++)
+        {
+            minv[j] = TRACK_INF;
+            used[j] = false;
+        }
+        do
+        {
+            used[j0] = true;
+            int i0 = p[j0], j1 = 0;
+            int32_t delta = TRACK_INF;
+            for (int j = 1; j <= n; j++)
+            {
+                if (!used[j])
+                {
+                    int32_t cur = COST(i0, j) - u[i0] - v[j];
+                    if (cur < minv[j])
+                    {
+                        minv[j] = cur;
+                        way[j] = (int8_t)j0;
+                    }
+                    if (minv[j] < delta)
+                    {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+            }
+            for (int j = 0; j <= n; j++)
+            {
+                if (used[j])
+                {
+                    u[p[j]] += delta;
+                    v[j] -= delta;
+                }
+                else
+                {
+                    minv[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (p[j0] != 0);
+        do
+        {
+            int j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0);
+    }
+#undef COST
+
+    // padding and pairs under the threshold stay apart
+    for (int j = 1; j <= boxes; j++)
+    {
+        int t = p[j] - 1;
+        if (t < tracks && tracker->overlap[t][j - 1] >= min_overlap && tracker->overlap[t][j - 1] > 0)
+        {
+            tracker->match[t] = (int8_t)(j - 1);
+        }
+    }
+}
+
+void tracker_init(tracker_t *tracker, uint8_t min_hits, uint8_t max_age, uint8_t iou, track_assign_t assign)
+{
+    memset(tracker, 0, sizeof(tracker_t));
+    tracker->next_id = 1;
+    tracker->min_hits = min_hits;
+    tracker->max_age = max_age;
+    tracker->iou = iou;
+    tracker->assign = assign;
+}
+
+void tracker_reset(tracker_t *tracker)
+{
+    tracker->count = 0;
+}
+
+int tracker_update(tracker_t *tracker, const detect_box_t *boxes, int n, track_object_t *out, int max_out)
+{
+    const int tracks = tracker->count;
+    const uint16_t min_overlap = (uint16_t)(((uint32_t)tracker->iou << 15) / 100);
+    bool spawned[TRACK_MAX];
+    n = MIN(MAX(n, 0), TRACK_MAX);
+
+    for (int t = 0; t < tracks; t++)
+    {
+        track_t *track = &tracker->tracks[t];
+        for (int a = 0; a < 4; a++)
+        {
+            axis_predict(&track->axis[a]);
+        }
+        detect_box_t predicted = track_box(track);
+        for (int d = 0; d < n; d++)
+        {
+            tracker->overlap[t][d] = boxes[d].target == track->target ? detect_iou_q15(&predicted, &boxes[d]) : 0;
+        }
+        tracker->match[t] = -1;
+    }
+
+    if (tracks && n)
+    {
+        if (tracker->assign == TRACK_HUNGARIAN)
+        {
+            assign_hungarian(tracker, tracks, n, min_overlap);
+        }
+        else
+        {
+            assign_greedy(tracker, tracks, n, min_overlap);
+        }
+    }
+
+    // correct the matched tracks, age the others and retire the lost ones, in order
+    for (int d = 0; d < n; d++)
+    {
+        spawned[d] = true;
+    }
+    uint8_t kept = 0;
+    for (int t = 0; t < tracks; t++)
+    {
+        track_t *track = &tracker->tracks[t];
+        if (tracker->match[t] >= 0)
+        {
+            track_correct(track, &boxes[tracker->match[t]]);
+            spawned[tracker->match[t]] = false;
+        }
+        else if (++track->missed > tracker->max_age)
+        {
+            continue;
+        }
+        tracker->tracks[kept++] = *track;
+    }
+    tracker->count = kept;
+
+    for (int d = 0; d < n && tracker->count < TRACK_MAX; d++)
+    {
+        if (spawned[d])
+        {
+            track_start(tracker, &boxes[d]);
+        }
+    }
+    return tracker_report(tracker, out, max_out);
+}
+
+int tracker_predict(tracker_t *tracker, track_object_t *out, int max_out)
+{
+    for (uint8_t t = 0; t < tracker->count; t++)
+    {
+        for (int a = 0; a < 4; a++)
+        {
+            axis_predict(&tracker->tracks[t].axis[a]);
+        }
+    }
+    return tracker_report(tracker, out, max_out);
+}
+
+bool tracker_stable(const tracker_t *tracker)
+{
+    for (uint8_t t = 0; t < tracker->count; t++)
+    {
+        if (!track_reported(tracker, &tracker->tracks[t]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
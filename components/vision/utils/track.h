@@ -0,0 +1,115 @@
+/**
+*****************************************************************************************
+*     Copyright(c) 2022, Seeed Technology Corporation. All rights reserved.
+*****************************************************************************************
+* @file      track.h
+* @brief     SORT-style multi-object tracker in fixed point, without allocation
+* @version   v1.0
+**************************************************************************************
+* @attention
+* <h2><center>&copy; COPYRIGHT 2022 Seeed Technology Corporation</center></h2>
+**************************************************************************************
+*/
+#ifndef TRACK_H
+#define TRACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "detect.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* tracks, and detections per update, at most */
+#define TRACK_MAX 32
+
+    typedef enum
+    {
+        TRACK_GREEDY = 0,    /* best overlap first */
+        TRACK_HUNGARIAN = 1, /* the assignment with the most overlap in total */
+    } track_assign_t;
+
+    /*
+     * Constant-velocity Kalman filter of one coordinate: position and
+     * velocity in 1/16 pixel, covariance in 1/256 pixel^2.
+     */
+    typedef struct
+    {
+        int32_t x;
+        int32_t v;
+        int32_t p00, p01, p11;
+    } track_axis_t;
+
+    typedef struct
+    {
+        track_axis_t axis[4]; /* centre x, centre y, w, h */
+        uint16_t id;          /* never 0 */
+        uint16_t hits;        /* detections matched, the first included */
+        uint16_t missed;      /* detector frames in a row without a match */
+        uint8_t confidence;   /* of the last detection matched */
+        uint8_t target;
+    } track_t;
+
+    typedef struct
+    {
+        detect_box_t box;
+        uint16_t id;
+    } track_object_t;
+
+    /**
+     * @brief Tracks of one camera, updated in place
+     *
+     * Every detector frame, tracker_update() predicts each track a frame on,
+     * matches the tracks with the detections by IoU (same class only),
+     * corrects the matched tracks, starts a track for every detection left
+     * and retires the tracks missed more than max_age times in a row. Frames
+     * without detections go through tracker_predict(). A track is reported
+     * once it has min_hits detections, as long as its last detector frame
+     * matched it.
+     */
+    typedef struct
+    {
+        track_t tracks[TRACK_MAX];
+        uint8_t count;
+        uint16_t next_id;
+        uint8_t min_hits;
+        uint8_t max_age;
+        uint8_t iou;           /* % of overlap to match a track */
+        track_assign_t assign;
+
+        /* scratch of the association */
+        uint16_t overlap[TRACK_MAX][TRACK_MAX]; /* IoU in Q15, track by detection */
+        int8_t match[TRACK_MAX];                /* detection of each track, -1 for none */
+        int32_t u[TRACK_MAX + 1], v[TRACK_MAX + 1], minv[TRACK_MAX + 1];
+        int8_t p[TRACK_MAX + 1], way[TRACK_MAX + 1];
+        bool used[TRACK_MAX + 1];
+    } tracker_t;
+
+    void tracker_init(tracker_t *tracker, uint8_t min_hits, uint8_t max_age, uint8_t iou, track_assign_t assign);
+
+    /* forget every track, the ids go on */
+    void tracker_reset(tracker_t *tracker);
+
+    /**
+     * @brief Move the tracks a frame on and match them with the detections of that frame
+     *
+     * @param boxes  detections, TRACK_MAX at most are used, the first ones
+     * @param out    the tracks reported, at their corrected position
+     * @return tracks written to out
+     */
+    int tracker_update(tracker_t *tracker, const detect_box_t *boxes, int n, track_object_t *out, int max_out);
+
+    /* move the tracks a frame on without a detector frame, returns the tracks reported at their predicted position */
+    int tracker_predict(tracker_t *tracker, track_object_t *out, int max_out);
+
+    /* no track waiting for hits or missed in the last detector frame: the detector can run less often */
+    bool tracker_stable(const tracker_t *tracker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -26,8 +26,8 @@ extern "C" void app_main()
   xQueueAIFrame = xQueueCreate(2, sizeof(camera_fb_t *));
   xQueueLCDFrame = xQueueCreate(2, sizeof(camera_fb_t *));
 
-  register_camera(PIXFORMAT_RGB565, FRAMESIZE_240X240, 2, xQueueAIFrame);
-  register_pfld_meter(xQueueAIFrame, NULL, NULL, xQueueLCDFrame, false);
+  register_camera(PIXFORMAT_RGB565, FRAMESIZE_240X240, 3, xQueueAIFrame, CAMERA_DELIVER_LATEST);
+  register_pfld_meter(xQueueAIFrame, NULL, NULL, xQueueLCDFrame, true);
   register_lcd(xQueueLCDFrame, NULL, true);
 
 }